@@ -1,19 +1,27 @@
 // Copyright 2022 Michael Fisher <mfisher@lvtk.org>
 // SPDX-License-Identifier: ISC
 
+#include "lvtk/dsp/kernels.hpp"
+#include "lvtk/dsp/math.hpp"
+#include "lvtk/dsp/smoother.hpp"
 #include "lvtk/lvtk.hpp"
 #include "lvtk/plugin.hpp"
 
-#include <cmath>
 #include <cstdint>
-#include <vector>
 
 #define LVTK_VOLUME_URI "https://lvtk.org/plugins/volume"
 
 class Volume : public lvtk::Plugin<Volume> {
 public:
-    Volume (const lvtk::Args& args) : Plugin (args) {
-        lpf = 990.f / static_cast<float> (args.sample_rate);
+    Volume (const lvtk::Args& args)
+        : Plugin (args),
+          dsp (lvtk::dsp::kernels()),
+          gain (lvtk::dsp::SmoothingType::ONE_POLE) {
+        // ~16ms time constant, exact every 16 frames with SIMD ramps between
+        gain.prepare (args.sample_rate, 0.016, 16);
+        gain.set_transform ([] (float db) {
+            return db > -90.0f ? lvtk::dsp::approx::db_to_gain (db) : 0.0f;
+        });
     }
 
     void connect_port (uint32_t port, void* data) {
@@ -26,47 +34,19 @@ public:
         else if (port == 3)
             output[1] = (float*) data;
         else if (port == 4)
-            db = (float*) data;
+            gain.connect (data);
     }
 
     void run (uint32_t nframes) {
-        gains.next = *db > -90.0f ? powf (10.0f, *db * 0.05f) : 0.0f;
-
-        if (fabsf (gains.last - gains.next) < 0.01) {
-            // constant gain
-            for (uint32_t c = 0; c < 2; ++c)
-                for (uint32_t f = 0; f < nframes; ++f)
-                    output[c][f] = input[c][f] * gains.next;
-            gains.last = gains.next;
-        } else {
-            // smoothed gain
-            float gain     = gains.last;
-            uint32_t begin = 0;
-
-            while (begin < nframes) {
-                uint32_t remain = nframes - begin;
-                uint32_t todo   = remain > 16 ? 16 : remain;
-                gain += lpf * (gains.next - gain);
-                for (uint32_t c = 0; c < 2; ++c)
-                    for (uint32_t f = begin; f < begin + todo; ++f)
-                        output[c][f] = input[c][f] * gain;
-                begin += todo;
-            }
-
-            gains.last = gain;
-        }
+        gain.update();
+        gain.apply (dsp, output, input, 2, nframes);
     }
 
 private:
+    const lvtk::dsp::Kernels& dsp;
+    lvtk::dsp::ControlSmoother gain;
     float* input[2] { 0, 0 };
     float* output[2] { 0, 0 };
-    float* db = nullptr;
-    float lpf = 0.f;
-
-    struct Gains {
-        float last = 0.f;
-        float next = 1.f;
-    } gains;
 };
 
 static const lvtk::Descriptor<Volume> volume (LVTK_VOLUME_URI);
@@ -0,0 +1,231 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN 1
+#        define LVTK_ARENA_LEAN 1
+#    endif
+#    ifndef NOMINMAX
+#        define NOMINMAX 1
+#        define LVTK_ARENA_NOMINMAX 1
+#    endif
+#    include <windows.h>
+#    ifdef LVTK_ARENA_LEAN
+#        undef WIN32_LEAN_AND_MEAN
+#        undef LVTK_ARENA_LEAN
+#    endif
+#    ifdef LVTK_ARENA_NOMINMAX
+#        undef NOMINMAX
+#        undef LVTK_ARENA_NOMINMAX
+#    endif
+#elif defined(__unix__) || defined(__APPLE__)
+#    include <sys/mman.h>
+#    include <unistd.h>
+#    define LVTK_ARENA_MMAP 1
+#endif
+
+namespace lvtk {
+
+/** How an Arena should be backed.
+    @headerfile lvtk/arena.hpp
+    @ingroup lvtk
+ */
+struct ArenaOptions final {
+    /** Usable bytes, not counting alignment padding */
+    std::size_t size = 0;
+    /** Ask for transparent huge pages (Linux).  A hint, never an error. */
+    bool huge_pages = false;
+    /** Lock the memory so it can't be paged out.  Best effort, see
+        Arena::locked() for the outcome.
+     */
+    bool lock = false;
+};
+
+/** A monotonic memory arena.
+
+    One block of memory is mapped and pre-faulted up front, then handed out
+    front to back.  Nothing is freed until the whole arena is destroyed, so
+    allocation is a pointer bump, never blocks and is realtime safe.
+
+    Sub-allocations are cache line aligned by default, which keeps
+    unrelated state of neighbouring objects out of each other's lines.
+
+    Destructors of objects made with make() never run, so only trivially
+    destructible types may be placed there.
+
+    @see InstanceArena, which places a whole Plugin instance in an arena.
+    @headerfile lvtk/arena.hpp
+    @ingroup lvtk
+ */
+class Arena final {
+public:
+    /** Default alignment of allocations */
+    static constexpr std::size_t cache_line = 64;
+
+    /** Map a new arena.  Returns nullptr if the memory is not available. */
+    static Arena* create (const ArenaOptions& options) noexcept {
+        const std::size_t header = round_up (sizeof (Arena), cache_line);
+        if (options.size > SIZE_MAX - header - huge_page_size)
+            return nullptr;
+        std::size_t total = header + round_up (options.size, cache_line);
+        bool huge = false, locked = false;
+        void* mem = nullptr;
+
+#if defined(LVTK_ARENA_MMAP)
+        const std::size_t page = (std::size_t) ::sysconf (_SC_PAGESIZE);
+        total                  = round_up (total, options.huge_pages ? huge_page_size : page);
+        // no MAP_POPULATE: pages faulted before madvise() would all be small
+        mem = ::mmap (nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED)
+            return nullptr;
+#    if defined(MADV_HUGEPAGE)
+        if (options.huge_pages)
+            huge = ::madvise (mem, total, MADV_HUGEPAGE) == 0;
+#    endif
+        // fault everything in now, not during the first run()
+#    if defined(MADV_POPULATE_WRITE)
+        if (::madvise (mem, total, MADV_POPULATE_WRITE) != 0)
+#    endif
+            touch (mem, total, page);
+        if (options.lock)
+            locked = ::mlock (mem, total) == 0;
+#elif defined(_WIN32)
+        mem = ::VirtualAlloc (nullptr, total, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+        if (mem == nullptr)
+            return nullptr;
+        if (options.lock)
+            locked = ::VirtualLock (mem, total) != 0;
+        if (! locked)
+            touch (mem, total, 4096);
+#else
+        mem = ::operator new (total, std::align_val_t (cache_line), std::nothrow);
+        if (mem == nullptr)
+            return nullptr;
+        std::memset (mem, 0, total);
+#endif
+
+        auto arena         = new (mem) Arena();
+        arena->_begin      = static_cast<uint8_t*> (mem) + header;
+        arena->_capacity   = total - header;
+        arena->_mapped     = total;
+        arena->_huge_pages = huge;
+        arena->_locked     = locked;
+        return arena;
+    }
+
+    /** Unmap an arena created with create().  Does not run destructors. */
+    static void destroy (Arena* arena) noexcept {
+        if (arena == nullptr)
+            return;
+        void* mem               = arena;
+        const std::size_t total = arena->_mapped;
+        const bool locked       = arena->_locked;
+        arena->~Arena();
+
+#if defined(LVTK_ARENA_MMAP)
+        if (locked)
+            ::munlock (mem, total);
+        ::munmap (mem, total);
+#elif defined(_WIN32)
+        if (locked)
+            ::VirtualUnlock (mem, total);
+        ::VirtualFree (mem, 0, MEM_RELEASE);
+#else
+        (void) total;
+        (void) locked;
+        ::operator delete (mem, std::align_val_t (cache_line));
+#endif
+    }
+
+    /** Returns `size` bytes aligned to `align` (a power of two), or
+        nullptr if the arena is exhausted.
+     */
+    void* allocate (std::size_t size, std::size_t align = cache_line) noexcept {
+        const auto base   = reinterpret_cast<std::uintptr_t> (_begin);
+        const auto offset = round_up (base + _used, align) - base;
+        if (offset > _capacity || size > _capacity - offset)
+            return nullptr;
+        _used = offset + size;
+        return _begin + offset;
+    }
+
+    /** Construct a T in the arena, or return nullptr if exhausted. */
+    template <typename T, typename... Args>
+    T* make (Args&&... args) {
+        static_assert (std::is_trivially_destructible<T>::value,
+                       "Arena never runs destructors");
+        void* mem = allocate (sizeof (T), alignof (T) > cache_line ? alignof (T) : cache_line);
+        return mem != nullptr ? new (mem) T (std::forward<Args> (args)...) : nullptr;
+    }
+
+    /** Allocate `count` value initialized T's, or nullptr if exhausted. */
+    template <typename T>
+    T* make_array (std::size_t count) {
+        static_assert (std::is_trivially_destructible<T>::value,
+                       "Arena never runs destructors");
+        if (count > SIZE_MAX / sizeof (T))
+            return nullptr;
+        void* mem = allocate (sizeof (T) * count, alignof (T) > cache_line ? alignof (T) : cache_line);
+        return mem != nullptr ? new (mem) T[count]() : nullptr;
+    }
+
+    /** Returns true if `ptr` points into this arena */
+    bool owns (const void* ptr) const noexcept {
+        const auto p = static_cast<const uint8_t*> (ptr);
+        return p >= _begin && p < _begin + _capacity;
+    }
+
+    /** Returns the number of usable bytes */
+    std::size_t capacity() const noexcept { return _capacity; }
+
+    /** Returns the bytes handed out so far, including alignment padding */
+    std::size_t used() const noexcept { return _used; }
+
+    /** Returns the bytes still available */
+    std::size_t remaining() const noexcept { return _capacity - _used; }
+
+    /** Returns true if huge pages were granted */
+    bool huge_pages() const noexcept { return _huge_pages; }
+
+    /** Returns true if the memory is locked */
+    bool locked() const noexcept { return _locked; }
+
+    Arena (const Arena&)            = delete;
+    Arena& operator= (const Arena&) = delete;
+
+private:
+    static constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+    uint8_t* _begin        = nullptr;
+    std::size_t _capacity  = 0;
+    std::size_t _used      = 0;
+    std::size_t _mapped    = 0;
+    bool _huge_pages       = false;
+    bool _locked           = false;
+
+    Arena()  = default;
+    ~Arena() = default;
+
+    static constexpr std::size_t round_up (std::size_t value, std::size_t align) noexcept {
+        return (value + align - 1) & ~(align - 1);
+    }
+
+    /** Write a byte to each page so the OS backs it now */
+    static void touch (void* mem, std::size_t size, std::size_t page) noexcept {
+        auto bytes = static_cast<volatile uint8_t*> (mem);
+        for (std::size_t i = 0; i < size; i += page)
+            bytes[i] = 0;
+    }
+};
+
+} // namespace lvtk
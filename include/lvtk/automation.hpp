@@ -0,0 +1,279 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include <lvtk/dsp/kernels.hpp>
+#include <lvtk/dsp/smoother.hpp>
+#include <lvtk/static_vector.hpp>
+
+#include <lv2/atom/atom.h>
+#include <lv2/atom/util.h>
+#include <lv2/patch/patch.h>
+#include <lv2/urid/urid.h>
+
+namespace lvtk {
+
+/** A parameter value at a frame in the current block
+    @headerfile lvtk/automation.hpp
+ */
+struct Breakpoint {
+    uint32_t frame; ///< Frame in the block
+    float value;    ///< Value from this frame on
+};
+
+/** How Automation::render() joins breakpoints
+    @headerfile lvtk/automation.hpp
+ */
+enum class AutomationCurve : uint32_t {
+    STEP = 0, ///< Jump to each value on its frame
+    LINEAR    ///< Ramp from each value to the next, hold after the last
+};
+
+/** Sample accurate parameter changes from patch:Set events.
+
+    Register the parameters' property URIDs, then call scan() once per
+    block with the control input sequence.  Each patch:Set for a registered
+    property becomes a breakpoint at its event frame, so changes can be
+    applied where they happened instead of at the start of the block.
+    Properties are matched with a single pass over each object.
+
+    Use render() for a per-sample value buffer, render() with a Smoother to
+    smooth between breakpoints, or segments() to drive your own code.
+
+    Nothing here allocates.  When more than `MaxPoints` changes of one
+    parameter arrive in a block, the extra ones replace the last point, so
+    the final value is always right.
+
+    @code
+        // constructor
+        cutoff = automation.add_parameter (map (MY_URI "#cutoff"), 1000.f);
+
+        // run()
+        automation.scan (control_port, nframes);
+        automation.render (dsp, cutoff, cutoff_buffer, nframes, lvtk::AutomationCurve::LINEAR);
+    @endcode
+
+    @tparam MaxParams  Parameters which can be registered
+    @tparam MaxPoints  Breakpoints per parameter per block
+    @headerfile lvtk/automation.hpp
+ */
+template <uint32_t MaxParams = 16, uint32_t MaxPoints = 32>
+class Automation final {
+public:
+    /** Maps the patch and atom URIDs.  Not realtime safe. */
+    explicit Automation (LV2_URID_Map* map) {
+        auto m          = [map] (const char* uri) { return map->map (map->handle, uri); };
+        _patch_set      = m (LV2_PATCH__Set);
+        _patch_property = m (LV2_PATCH__property);
+        _patch_value    = m (LV2_PATCH__value);
+        _atom_object    = m (LV2_ATOM__Object);
+        _atom_blank     = m (LV2_ATOM__Blank);
+        _atom_resource  = m (LV2_ATOM__Resource);
+        _atom_float     = m (LV2_ATOM__Float);
+        _atom_double    = m (LV2_ATOM__Double);
+        _atom_int       = m (LV2_ATOM__Int);
+        _atom_long      = m (LV2_ATOM__Long);
+        _atom_bool      = m (LV2_ATOM__Bool);
+        _atom_urid      = m (LV2_ATOM__URID);
+    }
+
+    /** Register a parameter.
+        @param property  The patch:property URID
+        @param initial   The value before any patch:Set arrives
+        @returns The parameter index, or -1 if full
+     */
+    int add_parameter (LV2_URID property, float initial = 0.f) noexcept {
+        for (uint32_t i = 0; i < _params.size(); ++i)
+            if (_params[i].property == property)
+                return (int) i;
+        if (! _params.push_back ({ property, initial, initial, {} }))
+            return -1;
+        return (int) _params.size() - 1;
+    }
+
+    /** Returns the number of registered parameters */
+    uint32_t size() const noexcept { return _params.size(); }
+
+    /** Set a value directly, e.g. after restoring state.  Clears the
+        parameter's breakpoints.
+     */
+    void set_value (int param, float value) noexcept {
+        auto& p = _params[(uint32_t) param];
+        p.start = p.value = value;
+        p.points.clear();
+    }
+
+    /** Returns the value at the end of the block */
+    float value (int param) const noexcept { return _params[(uint32_t) param].value; }
+
+    /** Returns the value at the start of the block */
+    float start_value (int param) const noexcept { return _params[(uint32_t) param].start; }
+
+    /** Returns true if the parameter changed in this block */
+    bool changed (int param) const noexcept { return ! _params[(uint32_t) param].points.empty(); }
+
+    /** Returns the parameter's breakpoints in this block, by frame */
+    const StaticVector<Breakpoint, MaxPoints>& breakpoints (int param) const noexcept {
+        return _params[(uint32_t) param].points;
+    }
+
+    /** Read patch:Set events for a block of `nframes`.
+
+        Events must have frame timestamps.  Those outside the block are
+        clamped to its first or last frame.  Realtime safe.
+
+        @returns The number of registered parameters set
+     */
+    uint32_t scan (const LV2_Atom_Sequence* seq, uint32_t nframes) noexcept {
+        for (auto& p : _params) {
+            p.start = p.value;
+            p.points.clear();
+        }
+
+        if (seq == nullptr)
+            return 0;
+
+        uint32_t found = 0;
+        const uint32_t last = nframes > 0 ? nframes - 1 : 0;
+        LV2_ATOM_SEQUENCE_FOREACH (seq, ev) {
+            LV2_URID property = 0;
+            float value       = 0.f;
+            if (! decode (&ev->body, property, value))
+                continue;
+
+            for (auto& p : _params) {
+                if (p.property != property)
+                    continue;
+                const int64_t t      = ev->time.frames;
+                const uint32_t frame = t < 0 ? 0 : (t > (int64_t) last ? last : (uint32_t) t);
+                if (! p.points.empty() && (p.points.back().frame >= frame || p.points.full()))
+                    p.points.back().value = value;
+                else
+                    p.points.push_back ({ frame, value });
+                p.value = value;
+                ++found;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+    /** Call `fn (offset, nframes, value)` for each run of frames with a
+        constant value, in order.  Covers the whole block.
+     */
+    template <class Fn>
+    void segments (int param, uint32_t nframes, Fn&& fn) const {
+        const auto& p  = _params[(uint32_t) param];
+        uint32_t pos   = 0;
+        float current  = p.start;
+        for (const auto& bp : p.points) {
+            if (bp.frame > pos)
+                fn (pos, bp.frame - pos, current);
+            pos     = bp.frame;
+            current = bp.value;
+        }
+        if (nframes > pos)
+            fn (pos, nframes - pos, current);
+    }
+
+    /** Write per-sample values of a parameter to `dst` */
+    void render (const dsp::Kernels& k, int param, float* dst, uint32_t nframes,
+                 AutomationCurve curve = AutomationCurve::STEP) const noexcept {
+        const auto& p = _params[(uint32_t) param];
+        if (curve == AutomationCurve::STEP || p.points.empty()) {
+            segments (param, nframes, [&] (uint32_t offset, uint32_t n, float value) {
+                k.fill (dst + offset, value, n);
+            });
+            return;
+        }
+
+        // ramp from the start value through every breakpoint
+        uint32_t pos = 0;
+        float from   = p.start;
+        for (const auto& bp : p.points) {
+            if (bp.frame > pos)
+                k.ramp (dst + pos, from, bp.value, bp.frame - pos);
+            pos  = bp.frame;
+            from = bp.value;
+        }
+        if (nframes > pos)
+            k.fill (dst + pos, from, nframes - pos);
+    }
+
+    /** Write per-sample values of a parameter through a Smoother, which
+        gets a new target at each breakpoint.
+     */
+    void render (const dsp::Kernels& k, int param, dsp::Smoother& smoother, float* dst, uint32_t nframes) const noexcept {
+        segments (param, nframes, [&] (uint32_t offset, uint32_t n, float value) {
+            smoother.set_target (value);
+            smoother.render (k, dst + offset, n);
+        });
+    }
+
+private:
+    struct Param {
+        LV2_URID property;
+        float start;
+        float value;
+        StaticVector<Breakpoint, MaxPoints> points;
+    };
+
+    StaticVector<Param, MaxParams> _params;
+    LV2_URID _patch_set = 0, _patch_property = 0, _patch_value = 0;
+    LV2_URID _atom_object = 0, _atom_blank = 0, _atom_resource = 0;
+    LV2_URID _atom_float = 0, _atom_double = 0, _atom_int = 0, _atom_long = 0, _atom_bool = 0;
+    LV2_URID _atom_urid = 0;
+
+    /** Single pass over a patch:Set, true if it has a property and a
+        numeric value.
+     */
+    bool decode (const LV2_Atom* atom, LV2_URID& property, float& value) const noexcept {
+        if (atom->type != _atom_object && atom->type != _atom_blank && atom->type != _atom_resource)
+            return false;
+        const auto obj = reinterpret_cast<const LV2_Atom_Object*> (atom);
+        if (obj->body.otype != _patch_set)
+            return false;
+
+        const LV2_Atom* val = nullptr;
+        property            = 0;
+        LV2_ATOM_OBJECT_FOREACH (obj, prop) {
+            if (prop->key == _patch_property && prop->value.type == _atom_urid && prop->value.size >= sizeof (uint32_t))
+                std::memcpy (&property, LV2_ATOM_BODY_CONST (&prop->value), sizeof (uint32_t));
+            else if (prop->key == _patch_value)
+                val = &prop->value;
+            if (property != 0 && val != nullptr)
+                break;
+        }
+
+        return property != 0 && val != nullptr && to_float (val, value);
+    }
+
+    bool to_float (const LV2_Atom* atom, float& value) const noexcept {
+        const void* body = LV2_ATOM_BODY_CONST (atom);
+        if (atom->type == _atom_float && atom->size >= sizeof (float)) {
+            std::memcpy (&value, body, sizeof (float));
+        } else if (atom->type == _atom_double && atom->size >= sizeof (double)) {
+            double d;
+            std::memcpy (&d, body, sizeof (double));
+            value = (float) d;
+        } else if ((atom->type == _atom_int || atom->type == _atom_bool) && atom->size >= sizeof (int32_t)) {
+            int32_t i;
+            std::memcpy (&i, body, sizeof (int32_t));
+            value = (float) i;
+        } else if (atom->type == _atom_long && atom->size >= sizeof (int64_t)) {
+            int64_t l;
+            std::memcpy (&l, body, sizeof (int64_t));
+            value = (float) l;
+        } else {
+            return false;
+        }
+        return true;
+    }
+};
+
+} // namespace lvtk
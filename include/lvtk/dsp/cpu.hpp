@@ -0,0 +1,133 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#endif
+
+#if ! defined(LVTK_DSP_NO_SIMD) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+/** Defined to 1 when x86 SIMD kernels are compiled in. Define
+    LVTK_DSP_NO_SIMD before including to force scalar code only.
+ */
+#    define LVTK_DSP_X86 1
+#else
+#    define LVTK_DSP_X86 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+/** Compile a single function for the given instruction set. MSVC does not
+    need this since intrinsics are always available there.
+ */
+#    define LVTK_DSP_TARGET(isa) __attribute__ ((target (isa)))
+#else
+#    define LVTK_DSP_TARGET(isa)
+#endif
+
+namespace lvtk {
+namespace dsp {
+
+/** Instruction sets which DSP kernels can be dispatched to.
+    @ingroup dsp
+    @headerfile lvtk/dsp/cpu.hpp
+ */
+enum class ISA : uint32_t {
+    SCALAR = 0, ///< Portable C++, no intrinsics
+    SSE2,       ///< x86 SSE2 (128 bit)
+    AVX2,       ///< x86 AVX2 (256 bit)
+    AVX512      ///< x86 AVX-512F (512 bit)
+};
+
+/** Returns a printable name for an ISA
+    @ingroup dsp
+ */
+inline const char* isa_name (ISA isa) noexcept {
+    switch (isa) {
+        case ISA::SSE2:
+            return "sse2";
+        case ISA::AVX2:
+            return "avx2";
+        case ISA::AVX512:
+            return "avx512";
+        case ISA::SCALAR:
+        default:
+            break;
+    }
+    return "scalar";
+}
+
+/** Returns true if the running CPU and OS can execute code for `isa`.
+
+    This queries CPUID (and XCR0 for the AVX variants) every time it is
+    called, so cache the result. @ref kernels() already does.
+
+    @ingroup dsp
+ */
+inline bool isa_supported (ISA isa) noexcept {
+    if (isa == ISA::SCALAR)
+        return true;
+#if LVTK_DSP_X86
+#    if defined(_MSC_VER) && ! defined(__clang__)
+    int info[4] = { 0, 0, 0, 0 };
+    __cpuid (info, 0);
+    const int max_leaf = info[0];
+    __cpuid (info, 1);
+    const bool sse2    = (info[3] & (1 << 26)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx     = (info[2] & (1 << 28)) != 0;
+    const auto xcr0    = osxsave ? _xgetbv (0) : 0ull;
+    const bool os_ymm  = (xcr0 & 0x06) == 0x06;
+    const bool os_zmm  = (xcr0 & 0xe6) == 0xe6;
+    bool avx2 = false, avx512f = false;
+    if (max_leaf >= 7) {
+        __cpuidex (info, 7, 0);
+        avx2    = (info[1] & (1 << 5)) != 0;
+        avx512f = (info[1] & (1 << 16)) != 0;
+    }
+    switch (isa) {
+        case ISA::SSE2:
+            return sse2;
+        case ISA::AVX2:
+            return avx && avx2 && os_ymm;
+        case ISA::AVX512:
+            return avx512f && os_zmm;
+        default:
+            break;
+    }
+    return false;
+#    else
+    // libgcc / compiler-rt also check XCR0 for OS support of the wide registers
+    __builtin_cpu_init();
+    switch (isa) {
+        case ISA::SSE2:
+            return __builtin_cpu_supports ("sse2");
+        case ISA::AVX2:
+            return __builtin_cpu_supports ("avx2");
+        case ISA::AVX512:
+            return __builtin_cpu_supports ("avx512f");
+        default:
+            break;
+    }
+    return false;
+#    endif
+#else
+    return false;
+#endif
+}
+
+/** Returns the widest ISA supported on this machine.
+    @ingroup dsp
+ */
+inline ISA detect_isa() noexcept {
+    for (auto isa : { ISA::AVX512, ISA::AVX2, ISA::SSE2 })
+        if (isa_supported (isa))
+            return isa;
+    return ISA::SCALAR;
+}
+
+} // namespace dsp
+} // namespace lvtk
@@ -0,0 +1,157 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#    include <xmmintrin.h>
+/** Defined to 1 when denormals are controlled through MXCSR */
+#    define LVTK_DSP_MXCSR 1
+#else
+#    define LVTK_DSP_MXCSR 0
+#endif
+
+#if defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+/** Defined to 1 when denormals are controlled through FPCR */
+#    define LVTK_DSP_FPCR 1
+#else
+#    define LVTK_DSP_FPCR 0
+#endif
+
+namespace lvtk {
+namespace dsp {
+
+/** Diagnostic counters filled by a DenormalScope.
+
+    Written only by the thread owning the scope, safe to read from any
+    other thread.
+
+    @ingroup dsp
+    @headerfile lvtk/dsp/denormal.hpp
+ */
+struct DenormalStats final {
+    /** Number of scopes exited while counting */
+    std::atomic<uint64_t> blocks { 0 };
+
+    /** Number of those in which a result was flushed to zero or a
+        denormal operand was seen.  Always zero where unsupported.
+     */
+    std::atomic<uint64_t> flushed { 0 };
+
+    /** Zero both counters */
+    void reset() noexcept {
+        blocks.store (0, std::memory_order_relaxed);
+        flushed.store (0, std::memory_order_relaxed);
+    }
+
+private:
+    friend class DenormalScope;
+    static void bump (std::atomic<uint64_t>& counter) noexcept {
+        // single writer, no need for a locked add
+        counter.store (counter.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+/** Flushes denormals to zero for the lifetime of the scope.
+
+    Sets FTZ and DAZ in MXCSR on x86, FZ in FPCR on AArch64, and restores
+    the previous state, including the host's exception flags, on exit.
+    That is one control register read and two writes.  Elsewhere this does
+    nothing.
+
+    With `stats`, the sticky underflow and denormal flags are also checked
+    on exit, at the cost of one more read.
+
+    @code
+        void run (uint32_t nframes) {
+            lvtk::dsp::DenormalScope no_denormals;
+            filter.process (output, input, nframes);
+        }
+    @endcode
+
+    @see FlushDenormals to do this around every run() automatically.
+    @ingroup dsp
+    @headerfile lvtk/dsp/denormal.hpp
+ */
+class DenormalScope final {
+public:
+    explicit DenormalScope (DenormalStats* stats = nullptr) noexcept
+        : _stats (stats) {
+#if LVTK_DSP_MXCSR
+        _saved = _mm_getcsr();
+        // flags are sticky, clear them so the exit check sees only this scope
+        _mm_setcsr ((_saved | ftz | daz) & ~flags);
+#elif LVTK_DSP_FPCR
+        asm volatile ("mrs %0, fpcr" : "=r"(_saved));
+        asm volatile ("msr fpcr, %0" : : "r"(_saved | fz));
+        if (_stats != nullptr) {
+            asm volatile ("mrs %0, fpsr" : "=r"(_saved_status));
+            asm volatile ("msr fpsr, %0" : : "r"(_saved_status & ~flags));
+        }
+#endif
+    }
+
+    ~DenormalScope() {
+#if LVTK_DSP_MXCSR
+        if (_stats != nullptr)
+            count ((_mm_getcsr() & flags) != 0);
+        _mm_setcsr (_saved);
+#elif LVTK_DSP_FPCR
+        if (_stats != nullptr) {
+            uint64_t status;
+            asm volatile ("mrs %0, fpsr" : "=r"(status));
+            count ((status & flags) != 0);
+            asm volatile ("msr fpsr, %0" : : "r"(_saved_status));
+        }
+        asm volatile ("msr fpcr, %0" : : "r"(_saved));
+#else
+        if (_stats != nullptr)
+            count (false);
+#endif
+    }
+
+    DenormalScope (const DenormalScope&)            = delete;
+    DenormalScope& operator= (const DenormalScope&) = delete;
+
+private:
+    DenormalStats* _stats;
+
+#if LVTK_DSP_MXCSR
+    static constexpr unsigned int ftz   = 0x8000;
+    static constexpr unsigned int daz   = 0x0040;
+    static constexpr unsigned int flags = 0x0012; // underflow | denormal
+    unsigned int _saved;
+#elif LVTK_DSP_FPCR
+    static constexpr uint64_t fz    = 1u << 24;
+    static constexpr uint64_t flags = (1u << 7) | (1u << 3); // input denormal | underflow
+    uint64_t _saved;
+    uint64_t _saved_status { 0 };
+#endif
+
+    void count (bool flushed) noexcept {
+        DenormalStats::bump (_stats->blocks);
+        if (flushed)
+            DenormalStats::bump (_stats->flushed);
+    }
+};
+
+/** Returns true if the calling thread currently flushes denormals to zero
+    @ingroup dsp
+ */
+inline bool denormals_flushed() noexcept {
+#if LVTK_DSP_MXCSR
+    return (_mm_getcsr() & 0x8000) != 0;
+#elif LVTK_DSP_FPCR
+    uint64_t fpcr;
+    asm volatile ("mrs %0, fpcr" : "=r"(fpcr));
+    return (fpcr & (1u << 24)) != 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace dsp
+} // namespace lvtk
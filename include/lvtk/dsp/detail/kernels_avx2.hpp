@@ -0,0 +1,231 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/dsp/cpu.hpp>
+#include <lvtk/dsp/detail/kernels_scalar.hpp>
+
+#if LVTK_DSP_X86
+#    include <immintrin.h>
+
+namespace lvtk {
+namespace dsp {
+namespace avx2 {
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline float hmax (__m256 v) noexcept {
+    __m128 m = _mm_max_ps (_mm256_castps256_ps128 (v), _mm256_extractf128_ps (v, 1));
+    m        = _mm_max_ps (m, _mm_movehl_ps (m, m));
+    m        = _mm_max_ss (m, _mm_shuffle_ps (m, m, 1));
+    return _mm_cvtss_f32 (m);
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline double hsum (__m256 v) noexcept {
+    const __m256d lo = _mm256_cvtps_pd (_mm256_castps256_ps128 (v));
+    const __m256d hi = _mm256_cvtps_pd (_mm256_extractf128_ps (v, 1));
+    alignas (32) double lanes[4];
+    _mm256_store_pd (lanes, _mm256_add_pd (lo, hi));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void clear (float* dst, uint32_t n) noexcept {
+    const __m256 z = _mm256_setzero_ps();
+    uint32_t i     = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps (dst + i, z);
+    for (; i < n; ++i)
+        dst[i] = 0.f;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void copy (float* dst, const float* src, uint32_t n) noexcept {
+    if (dst == src)
+        return;
+    if (dst > src && dst < src + n) {
+        scalar::copy (dst, src, n);
+        return;
+    }
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps (dst + i, _mm256_loadu_ps (src + i));
+    for (; i < n; ++i)
+        dst[i] = src[i];
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void fill (float* dst, float value, uint32_t n) noexcept {
+    const __m256 v = _mm256_set1_ps (value);
+    uint32_t i     = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps (dst + i, v);
+    for (; i < n; ++i)
+        dst[i] = value;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void ramp (float* dst, float start, float end, uint32_t n) noexcept {
+    if (n == 0)
+        return;
+    const float step   = (end - start) / (float) n;
+    const __m256 vs    = _mm256_set1_ps (start);
+    const __m256 vd    = _mm256_set1_ps (step);
+    const __m256 eight = _mm256_set1_ps (8.f);
+    __m256 idx         = _mm256_setr_ps (0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+    uint32_t i         = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps (dst + i, _mm256_add_ps (vs, _mm256_mul_ps (vd, idx)));
+        idx = _mm256_add_ps (idx, eight);
+    }
+    for (; i < n; ++i)
+        dst[i] = start + step * (float) i;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void gain (float* dst, const float* src, float g, uint32_t n) noexcept {
+    const __m256 vg = _mm256_set1_ps (g);
+    uint32_t i      = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps (dst + i, _mm256_mul_ps (_mm256_loadu_ps (src + i), vg));
+    for (; i < n; ++i)
+        dst[i] = src[i] * g;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void gain_ramp (float* dst, const float* src, float start, float end, uint32_t n) noexcept {
+    if (n == 0)
+        return;
+    const float step   = (end - start) / (float) n;
+    const __m256 vs    = _mm256_set1_ps (start);
+    const __m256 vd    = _mm256_set1_ps (step);
+    const __m256 eight = _mm256_set1_ps (8.f);
+    __m256 idx         = _mm256_setr_ps (0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+    uint32_t i         = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 g = _mm256_add_ps (vs, _mm256_mul_ps (vd, idx));
+        _mm256_storeu_ps (dst + i, _mm256_mul_ps (_mm256_loadu_ps (src + i), g));
+        idx = _mm256_add_ps (idx, eight);
+    }
+    for (; i < n; ++i)
+        dst[i] = src[i] * (start + step * (float) i);
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void mix (float* dst, const float* src, uint32_t n) noexcept {
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps (dst + i, _mm256_add_ps (_mm256_loadu_ps (dst + i), _mm256_loadu_ps (src + i)));
+    for (; i < n; ++i)
+        dst[i] += src[i];
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void mix_gain (float* dst, const float* src, float g, uint32_t n) noexcept {
+    const __m256 vg = _mm256_set1_ps (g);
+    uint32_t i      = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 s = _mm256_mul_ps (_mm256_loadu_ps (src + i), vg);
+        _mm256_storeu_ps (dst + i, _mm256_add_ps (_mm256_loadu_ps (dst + i), s));
+    }
+    for (; i < n; ++i)
+        dst[i] += src[i] * g;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void interleave (float* dst, const float* const* src, uint32_t channels, uint32_t n) noexcept {
+    if (channels != 2) {
+        scalar::interleave (dst, src, channels, n);
+        return;
+    }
+    const float* l = src[0];
+    const float* r = src[1];
+    uint32_t i     = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 a  = _mm256_loadu_ps (l + i);
+        const __m256 b  = _mm256_loadu_ps (r + i);
+        const __m256 lo = _mm256_unpacklo_ps (a, b); // l0 r0 l1 r1 | l4 r4 l5 r5
+        const __m256 hi = _mm256_unpackhi_ps (a, b); // l2 r2 l3 r3 | l6 r6 l7 r7
+        _mm256_storeu_ps (dst + 2 * i, _mm256_permute2f128_ps (lo, hi, 0x20));
+        _mm256_storeu_ps (dst + 2 * i + 8, _mm256_permute2f128_ps (lo, hi, 0x31));
+    }
+    for (; i < n; ++i) {
+        dst[2 * i]     = l[i];
+        dst[2 * i + 1] = r[i];
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline void deinterleave (float* const* dst, const float* src, uint32_t channels, uint32_t n) noexcept {
+    if (channels != 2) {
+        scalar::deinterleave (dst, src, channels, n);
+        return;
+    }
+    float* l   = dst[0];
+    float* r   = dst[1];
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 a  = _mm256_loadu_ps (src + 2 * i);
+        const __m256 b  = _mm256_loadu_ps (src + 2 * i + 8);
+        const __m256 lo = _mm256_permute2f128_ps (a, b, 0x20); // l0 r0 l1 r1 l4 r4 l5 r5
+        const __m256 hi = _mm256_permute2f128_ps (a, b, 0x31); // l2 r2 l3 r3 l6 r6 l7 r7
+        _mm256_storeu_ps (l + i, _mm256_shuffle_ps (lo, hi, _MM_SHUFFLE (2, 0, 2, 0)));
+        _mm256_storeu_ps (r + i, _mm256_shuffle_ps (lo, hi, _MM_SHUFFLE (3, 1, 3, 1)));
+    }
+    for (; i < n; ++i) {
+        l[i] = src[2 * i];
+        r[i] = src[2 * i + 1];
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline float peak (const float* src, uint32_t n) noexcept {
+    const __m256 mask = _mm256_castsi256_ps (_mm256_set1_epi32 (0x7fffffff));
+    __m256 vp         = _mm256_setzero_ps();
+    uint32_t i        = 0;
+    for (; i + 8 <= n; i += 8)
+        vp = _mm256_max_ps (vp, _mm256_and_ps (_mm256_loadu_ps (src + i), mask));
+    float p = hmax (vp);
+    for (; i < n; ++i) {
+        const float a = std::fabs (src[i]);
+        p             = a > p ? a : p;
+    }
+    return p;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx2")
+inline float rms (const float* src, uint32_t n) noexcept {
+    if (n == 0)
+        return 0.f;
+    __m256 vs  = _mm256_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 x = _mm256_loadu_ps (src + i);
+        vs             = _mm256_add_ps (vs, _mm256_mul_ps (x, x));
+    }
+    double sum = hsum (vs);
+    for (; i < n; ++i)
+        sum += (double) src[i] * src[i];
+    return (float) std::sqrt (sum / (double) n);
+}
+
+} // namespace avx2
+} // namespace dsp
+} // namespace lvtk
+
+#endif
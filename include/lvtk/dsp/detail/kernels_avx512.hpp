@@ -0,0 +1,244 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/dsp/cpu.hpp>
+#include <lvtk/dsp/detail/kernels_avx2.hpp>
+
+#if LVTK_DSP_X86
+#    include <immintrin.h>
+
+// GCC 12 reports its own _mm512_undefined_* helpers as uninitialized
+#    if defined(__GNUC__) && ! defined(__clang__)
+#        pragma GCC diagnostic push
+#        pragma GCC diagnostic ignored "-Wuninitialized"
+#        pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#    endif
+
+namespace lvtk {
+namespace dsp {
+namespace avx512 {
+
+// AVX-512F has masked loads and stores, so tails are handled in-register
+// instead of falling back to a scalar loop.
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline __mmask16 tail_mask (uint32_t remain) noexcept {
+    return (__mmask16) ((1u << remain) - 1u);
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void clear (float* dst, uint32_t n) noexcept {
+    const __m512 z = _mm512_setzero_ps();
+    uint32_t i     = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm512_storeu_ps (dst + i, z);
+    if (i < n)
+        _mm512_mask_storeu_ps (dst + i, tail_mask (n - i), z);
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void copy (float* dst, const float* src, uint32_t n) noexcept {
+    if (dst == src)
+        return;
+    if (dst > src && dst < src + n) {
+        scalar::copy (dst, src, n);
+        return;
+    }
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm512_storeu_ps (dst + i, _mm512_loadu_ps (src + i));
+    if (i < n) {
+        const __mmask16 m = tail_mask (n - i);
+        _mm512_mask_storeu_ps (dst + i, m, _mm512_maskz_loadu_ps (m, src + i));
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void fill (float* dst, float value, uint32_t n) noexcept {
+    const __m512 v = _mm512_set1_ps (value);
+    uint32_t i     = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm512_storeu_ps (dst + i, v);
+    if (i < n)
+        _mm512_mask_storeu_ps (dst + i, tail_mask (n - i), v);
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void ramp (float* dst, float start, float end, uint32_t n) noexcept {
+    if (n == 0)
+        return;
+    const float step     = (end - start) / (float) n;
+    const __m512 vs      = _mm512_set1_ps (start);
+    const __m512 vd      = _mm512_set1_ps (step);
+    const __m512 sixteen = _mm512_set1_ps (16.f);
+    __m512 idx           = _mm512_setr_ps (0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f);
+    uint32_t i           = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps (dst + i, _mm512_add_ps (vs, _mm512_mul_ps (vd, idx)));
+        idx = _mm512_add_ps (idx, sixteen);
+    }
+    if (i < n)
+        _mm512_mask_storeu_ps (dst + i, tail_mask (n - i), _mm512_add_ps (vs, _mm512_mul_ps (vd, idx)));
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void gain (float* dst, const float* src, float g, uint32_t n) noexcept {
+    const __m512 vg = _mm512_set1_ps (g);
+    uint32_t i      = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm512_storeu_ps (dst + i, _mm512_mul_ps (_mm512_loadu_ps (src + i), vg));
+    if (i < n) {
+        const __mmask16 m = tail_mask (n - i);
+        _mm512_mask_storeu_ps (dst + i, m, _mm512_mul_ps (_mm512_maskz_loadu_ps (m, src + i), vg));
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void gain_ramp (float* dst, const float* src, float start, float end, uint32_t n) noexcept {
+    if (n == 0)
+        return;
+    const float step     = (end - start) / (float) n;
+    const __m512 vs      = _mm512_set1_ps (start);
+    const __m512 vd      = _mm512_set1_ps (step);
+    const __m512 sixteen = _mm512_set1_ps (16.f);
+    __m512 idx           = _mm512_setr_ps (0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f);
+    uint32_t i           = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m512 g = _mm512_add_ps (vs, _mm512_mul_ps (vd, idx));
+        _mm512_storeu_ps (dst + i, _mm512_mul_ps (_mm512_loadu_ps (src + i), g));
+        idx = _mm512_add_ps (idx, sixteen);
+    }
+    if (i < n) {
+        const __mmask16 m = tail_mask (n - i);
+        const __m512 g    = _mm512_add_ps (vs, _mm512_mul_ps (vd, idx));
+        _mm512_mask_storeu_ps (dst + i, m, _mm512_mul_ps (_mm512_maskz_loadu_ps (m, src + i), g));
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void mix (float* dst, const float* src, uint32_t n) noexcept {
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm512_storeu_ps (dst + i, _mm512_add_ps (_mm512_loadu_ps (dst + i), _mm512_loadu_ps (src + i)));
+    if (i < n) {
+        const __mmask16 m = tail_mask (n - i);
+        const __m512 s    = _mm512_add_ps (_mm512_maskz_loadu_ps (m, dst + i), _mm512_maskz_loadu_ps (m, src + i));
+        _mm512_mask_storeu_ps (dst + i, m, s);
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void mix_gain (float* dst, const float* src, float g, uint32_t n) noexcept {
+    const __m512 vg = _mm512_set1_ps (g);
+    uint32_t i      = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m512 s = _mm512_mul_ps (_mm512_loadu_ps (src + i), vg);
+        _mm512_storeu_ps (dst + i, _mm512_add_ps (_mm512_loadu_ps (dst + i), s));
+    }
+    if (i < n) {
+        const __mmask16 m = tail_mask (n - i);
+        const __m512 s    = _mm512_mul_ps (_mm512_maskz_loadu_ps (m, src + i), vg);
+        _mm512_mask_storeu_ps (dst + i, m, _mm512_add_ps (_mm512_maskz_loadu_ps (m, dst + i), s));
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void interleave (float* dst, const float* const* src, uint32_t channels, uint32_t n) noexcept {
+    if (channels != 2) {
+        scalar::interleave (dst, src, channels, n);
+        return;
+    }
+    const __m512i ilo = _mm512_setr_epi32 (0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i ihi = _mm512_setr_epi32 (8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    const float* l    = src[0];
+    const float* r    = src[1];
+    uint32_t i        = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m512 a = _mm512_loadu_ps (l + i);
+        const __m512 b = _mm512_loadu_ps (r + i);
+        _mm512_storeu_ps (dst + 2 * i, _mm512_permutex2var_ps (a, ilo, b));
+        _mm512_storeu_ps (dst + 2 * i + 16, _mm512_permutex2var_ps (a, ihi, b));
+    }
+    if (i < n) {
+        const float* tail[2] = { l + i, r + i };
+        avx2::interleave (dst + 2 * i, tail, 2, n - i);
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline void deinterleave (float* const* dst, const float* src, uint32_t channels, uint32_t n) noexcept {
+    if (channels != 2) {
+        scalar::deinterleave (dst, src, channels, n);
+        return;
+    }
+    const __m512i ieven = _mm512_setr_epi32 (0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i iodd  = _mm512_setr_epi32 (1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    float* l            = dst[0];
+    float* r            = dst[1];
+    uint32_t i          = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m512 a = _mm512_loadu_ps (src + 2 * i);
+        const __m512 b = _mm512_loadu_ps (src + 2 * i + 16);
+        _mm512_storeu_ps (l + i, _mm512_permutex2var_ps (a, ieven, b));
+        _mm512_storeu_ps (r + i, _mm512_permutex2var_ps (a, iodd, b));
+    }
+    if (i < n) {
+        float* const tail[2] = { l + i, r + i };
+        avx2::deinterleave (tail, src + 2 * i, 2, n - i);
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline float peak (const float* src, uint32_t n) noexcept {
+    __m512 vp  = _mm512_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        vp = _mm512_max_ps (vp, _mm512_abs_ps (_mm512_loadu_ps (src + i)));
+    if (i < n)
+        vp = _mm512_max_ps (vp, _mm512_abs_ps (_mm512_maskz_loadu_ps (tail_mask (n - i), src + i)));
+    return _mm512_reduce_max_ps (vp);
+}
+
+/** @private */
+LVTK_DSP_TARGET ("avx512f")
+inline float rms (const float* src, uint32_t n) noexcept {
+    if (n == 0)
+        return 0.f;
+    __m512 vs  = _mm512_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m512 x = _mm512_loadu_ps (src + i);
+        vs             = _mm512_add_ps (vs, _mm512_mul_ps (x, x));
+    }
+    if (i < n) {
+        const __m512 x = _mm512_maskz_loadu_ps (tail_mask (n - i), src + i);
+        vs             = _mm512_add_ps (vs, _mm512_mul_ps (x, x));
+    }
+    const __m512d lo = _mm512_cvtps_pd (_mm512_castps512_ps256 (vs));
+    const __m512d hi = _mm512_cvtps_pd (_mm256_castpd_ps (_mm512_extractf64x4_pd (_mm512_castps_pd (vs), 1)));
+    const double sum = _mm512_reduce_add_pd (_mm512_add_pd (lo, hi));
+    return (float) std::sqrt (sum / (double) n);
+}
+
+} // namespace avx512
+} // namespace dsp
+} // namespace lvtk
+
+#    if defined(__GNUC__) && ! defined(__clang__)
+#        pragma GCC diagnostic pop
+#    endif
+#endif
@@ -0,0 +1,104 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace lvtk {
+namespace dsp {
+namespace scalar {
+
+/** @private */
+inline void clear (float* dst, uint32_t n) noexcept {
+    std::memset (dst, 0, n * sizeof (float));
+}
+
+/** @private */
+inline void copy (float* dst, const float* src, uint32_t n) noexcept {
+    if (dst != src)
+        std::memmove (dst, src, n * sizeof (float));
+}
+
+/** @private */
+inline void fill (float* dst, float value, uint32_t n) noexcept {
+    for (uint32_t i = 0; i < n; ++i)
+        dst[i] = value;
+}
+
+/** @private */
+inline void ramp (float* dst, float start, float end, uint32_t n) noexcept {
+    if (n == 0)
+        return;
+    const float step = (end - start) / (float) n;
+    for (uint32_t i = 0; i < n; ++i)
+        dst[i] = start + step * (float) i;
+}
+
+/** @private */
+inline void gain (float* dst, const float* src, float g, uint32_t n) noexcept {
+    for (uint32_t i = 0; i < n; ++i)
+        dst[i] = src[i] * g;
+}
+
+/** @private */
+inline void gain_ramp (float* dst, const float* src, float start, float end, uint32_t n) noexcept {
+    if (n == 0)
+        return;
+    const float step = (end - start) / (float) n;
+    for (uint32_t i = 0; i < n; ++i)
+        dst[i] = src[i] * (start + step * (float) i);
+}
+
+/** @private */
+inline void mix (float* dst, const float* src, uint32_t n) noexcept {
+    for (uint32_t i = 0; i < n; ++i)
+        dst[i] += src[i];
+}
+
+/** @private */
+inline void mix_gain (float* dst, const float* src, float g, uint32_t n) noexcept {
+    for (uint32_t i = 0; i < n; ++i)
+        dst[i] += src[i] * g;
+}
+
+/** @private */
+inline void interleave (float* dst, const float* const* src, uint32_t channels, uint32_t n) noexcept {
+    for (uint32_t c = 0; c < channels; ++c)
+        for (uint32_t i = 0; i < n; ++i)
+            dst[i * channels + c] = src[c][i];
+}
+
+/** @private */
+inline void deinterleave (float* const* dst, const float* src, uint32_t channels, uint32_t n) noexcept {
+    for (uint32_t c = 0; c < channels; ++c)
+        for (uint32_t i = 0; i < n; ++i)
+            dst[c][i] = src[i * channels + c];
+}
+
+/** @private */
+inline float peak (const float* src, uint32_t n) noexcept {
+    float p = 0.f;
+    for (uint32_t i = 0; i < n; ++i) {
+        const float a = std::fabs (src[i]);
+        if (a > p)
+            p = a;
+    }
+    return p;
+}
+
+/** @private */
+inline float rms (const float* src, uint32_t n) noexcept {
+    if (n == 0)
+        return 0.f;
+    double sum = 0.0;
+    for (uint32_t i = 0; i < n; ++i)
+        sum += (double) src[i] * (double) src[i];
+    return (float) std::sqrt (sum / (double) n);
+}
+
+} // namespace scalar
+} // namespace dsp
+} // namespace lvtk
@@ -0,0 +1,214 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/dsp/cpu.hpp>
+#include <lvtk/dsp/detail/kernels_scalar.hpp>
+
+#if LVTK_DSP_X86
+#    include <emmintrin.h>
+
+namespace lvtk {
+namespace dsp {
+namespace sse2 {
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void clear (float* dst, uint32_t n) noexcept {
+    const __m128 z = _mm_setzero_ps();
+    uint32_t i     = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps (dst + i, z);
+    for (; i < n; ++i)
+        dst[i] = 0.f;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void copy (float* dst, const float* src, uint32_t n) noexcept {
+    if (dst == src)
+        return;
+    if (dst > src && dst < src + n) {
+        scalar::copy (dst, src, n); // overlapping, needs memmove semantics
+        return;
+    }
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps (dst + i, _mm_loadu_ps (src + i));
+    for (; i < n; ++i)
+        dst[i] = src[i];
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void fill (float* dst, float value, uint32_t n) noexcept {
+    const __m128 v = _mm_set1_ps (value);
+    uint32_t i     = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps (dst + i, v);
+    for (; i < n; ++i)
+        dst[i] = value;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void ramp (float* dst, float start, float end, uint32_t n) noexcept {
+    if (n == 0)
+        return;
+    const float step  = (end - start) / (float) n;
+    const __m128 vs   = _mm_set1_ps (start);
+    const __m128 vd   = _mm_set1_ps (step);
+    const __m128 four = _mm_set1_ps (4.f);
+    __m128 idx        = _mm_setr_ps (0.f, 1.f, 2.f, 3.f);
+    uint32_t i        = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps (dst + i, _mm_add_ps (vs, _mm_mul_ps (vd, idx)));
+        idx = _mm_add_ps (idx, four);
+    }
+    for (; i < n; ++i)
+        dst[i] = start + step * (float) i;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void gain (float* dst, const float* src, float g, uint32_t n) noexcept {
+    const __m128 vg = _mm_set1_ps (g);
+    uint32_t i      = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps (dst + i, _mm_mul_ps (_mm_loadu_ps (src + i), vg));
+    for (; i < n; ++i)
+        dst[i] = src[i] * g;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void gain_ramp (float* dst, const float* src, float start, float end, uint32_t n) noexcept {
+    if (n == 0)
+        return;
+    const float step  = (end - start) / (float) n;
+    const __m128 vs   = _mm_set1_ps (start);
+    const __m128 vd   = _mm_set1_ps (step);
+    const __m128 four = _mm_set1_ps (4.f);
+    __m128 idx        = _mm_setr_ps (0.f, 1.f, 2.f, 3.f);
+    uint32_t i        = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128 g = _mm_add_ps (vs, _mm_mul_ps (vd, idx));
+        _mm_storeu_ps (dst + i, _mm_mul_ps (_mm_loadu_ps (src + i), g));
+        idx = _mm_add_ps (idx, four);
+    }
+    for (; i < n; ++i)
+        dst[i] = src[i] * (start + step * (float) i);
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void mix (float* dst, const float* src, uint32_t n) noexcept {
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps (dst + i, _mm_add_ps (_mm_loadu_ps (dst + i), _mm_loadu_ps (src + i)));
+    for (; i < n; ++i)
+        dst[i] += src[i];
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void mix_gain (float* dst, const float* src, float g, uint32_t n) noexcept {
+    const __m128 vg = _mm_set1_ps (g);
+    uint32_t i      = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128 s = _mm_mul_ps (_mm_loadu_ps (src + i), vg);
+        _mm_storeu_ps (dst + i, _mm_add_ps (_mm_loadu_ps (dst + i), s));
+    }
+    for (; i < n; ++i)
+        dst[i] += src[i] * g;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void interleave (float* dst, const float* const* src, uint32_t channels, uint32_t n) noexcept {
+    if (channels != 2) {
+        scalar::interleave (dst, src, channels, n);
+        return;
+    }
+    const float* l = src[0];
+    const float* r = src[1];
+    uint32_t i     = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128 a = _mm_loadu_ps (l + i);
+        const __m128 b = _mm_loadu_ps (r + i);
+        _mm_storeu_ps (dst + 2 * i, _mm_unpacklo_ps (a, b));
+        _mm_storeu_ps (dst + 2 * i + 4, _mm_unpackhi_ps (a, b));
+    }
+    for (; i < n; ++i) {
+        dst[2 * i]     = l[i];
+        dst[2 * i + 1] = r[i];
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline void deinterleave (float* const* dst, const float* src, uint32_t channels, uint32_t n) noexcept {
+    if (channels != 2) {
+        scalar::deinterleave (dst, src, channels, n);
+        return;
+    }
+    float* l   = dst[0];
+    float* r   = dst[1];
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128 a = _mm_loadu_ps (src + 2 * i);
+        const __m128 b = _mm_loadu_ps (src + 2 * i + 4);
+        _mm_storeu_ps (l + i, _mm_shuffle_ps (a, b, _MM_SHUFFLE (2, 0, 2, 0)));
+        _mm_storeu_ps (r + i, _mm_shuffle_ps (a, b, _MM_SHUFFLE (3, 1, 3, 1)));
+    }
+    for (; i < n; ++i) {
+        l[i] = src[2 * i];
+        r[i] = src[2 * i + 1];
+    }
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline float peak (const float* src, uint32_t n) noexcept {
+    const __m128 mask = _mm_castsi128_ps (_mm_set1_epi32 (0x7fffffff));
+    __m128 vp         = _mm_setzero_ps();
+    uint32_t i        = 0;
+    for (; i + 4 <= n; i += 4)
+        vp = _mm_max_ps (vp, _mm_and_ps (_mm_loadu_ps (src + i), mask));
+    alignas (16) float lanes[4];
+    _mm_store_ps (lanes, vp);
+    float p = lanes[0];
+    for (int l = 1; l < 4; ++l)
+        p = lanes[l] > p ? lanes[l] : p;
+    for (; i < n; ++i) {
+        const float a = std::fabs (src[i]);
+        p             = a > p ? a : p;
+    }
+    return p;
+}
+
+/** @private */
+LVTK_DSP_TARGET ("sse2")
+inline float rms (const float* src, uint32_t n) noexcept {
+    if (n == 0)
+        return 0.f;
+    __m128 vs  = _mm_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128 x = _mm_loadu_ps (src + i);
+        vs             = _mm_add_ps (vs, _mm_mul_ps (x, x));
+    }
+    alignas (16) float lanes[4];
+    _mm_store_ps (lanes, vs);
+    double sum = (double) lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; ++i)
+        sum += (double) src[i] * src[i];
+    return (float) std::sqrt (sum / (double) n);
+}
+
+} // namespace sse2
+} // namespace dsp
+} // namespace lvtk
+
+#endif
@@ -0,0 +1,182 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+/** @defgroup dsp DSP
+    Realtime audio helpers
+
+    Small, allocation free building blocks for use inside `run()`.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <lvtk/dsp/cpu.hpp>
+#include <lvtk/dsp/detail/kernels_avx2.hpp>
+#include <lvtk/dsp/detail/kernels_avx512.hpp>
+#include <lvtk/dsp/detail/kernels_scalar.hpp>
+#include <lvtk/dsp/detail/kernels_sse2.hpp>
+
+namespace lvtk {
+namespace dsp {
+
+/** A table of audio buffer kernels for one instruction set.
+
+    Every function accepts unaligned buffers and any frame count.  Unless
+    noted otherwise, `dst` and `src` may be the same buffer (in-place), but
+    must not partially overlap.
+
+    Resolve the table once, typically in your plugin's constructor, and keep
+    the reference.  Calls then cost one indirect jump.
+
+    @code
+        class Gain : public lvtk::Plugin<Gain> {
+        public:
+            Gain (const lvtk::Args& args)
+                : Plugin (args), dsp (lvtk::dsp::kernels()) {}
+
+            void run (uint32_t nframes) {
+                dsp.gain (output, input, *gain, nframes);
+            }
+
+        private:
+            const lvtk::dsp::Kernels& dsp;
+            // ...
+        };
+    @endcode
+
+    @ingroup dsp
+    @headerfile lvtk/dsp/kernels.hpp
+ */
+struct Kernels final {
+    /** The instruction set these kernels were compiled for */
+    ISA isa;
+
+    /** dst[i] = 0 */
+    void (*clear) (float* dst, uint32_t n) noexcept;
+
+    /** dst[i] = src[i].  Overlapping buffers are allowed. */
+    void (*copy) (float* dst, const float* src, uint32_t n) noexcept;
+
+    /** dst[i] = value */
+    void (*fill) (float* dst, float value, uint32_t n) noexcept;
+
+    /** dst[i] = start + (end - start) * i / n
+
+        Generates the same curve @ref gain_ramp multiplies with, e.g. for
+        per-sample parameter buffers.
+     */
+    void (*ramp) (float* dst, float start, float end, uint32_t n) noexcept;
+
+    /** dst[i] = src[i] * gain */
+    void (*gain) (float* dst, const float* src, float gain, uint32_t n) noexcept;
+
+    /** dst[i] = src[i] * (start + (end - start) * i / n)
+
+        The last frame gets one step short of `end`, so consecutive blocks
+        ramping a -> b then b -> c join without a discontinuity.
+     */
+    void (*gain_ramp) (float* dst, const float* src, float start, float end, uint32_t n) noexcept;
+
+    /** dst[i] += src[i] */
+    void (*mix) (float* dst, const float* src, uint32_t n) noexcept;
+
+    /** dst[i] += src[i] * gain */
+    void (*mix_gain) (float* dst, const float* src, float gain, uint32_t n) noexcept;
+
+    /** Interleave `channels` planar buffers into `dst`.
+        `dst` must hold `channels * n` floats and not alias any source.
+     */
+    void (*interleave) (float* dst, const float* const* src, uint32_t channels, uint32_t n) noexcept;
+
+    /** Split an interleaved buffer into `channels` planar buffers.
+        No destination may alias `src`.
+     */
+    void (*deinterleave) (float* const* dst, const float* src, uint32_t channels, uint32_t n) noexcept;
+
+    /** Returns the maximum absolute sample value */
+    float (*peak) (const float* src, uint32_t n) noexcept;
+
+    /** Returns the root mean square of the buffer */
+    float (*rms) (const float* src, uint32_t n) noexcept;
+};
+
+namespace detail {
+// clang-format off
+#define LVTK_DSP_KERNEL_TABLE(ns, isa) {                                   \
+    isa, ns::clear, ns::copy, ns::fill, ns::ramp, ns::gain, ns::gain_ramp, \
+    ns::mix, ns::mix_gain, ns::interleave, ns::deinterleave, ns::peak,     \
+    ns::rms                                                                \
+}
+// clang-format on
+
+inline const Kernels& scalar_kernels() noexcept {
+    static const Kernels k = LVTK_DSP_KERNEL_TABLE (scalar, ISA::SCALAR);
+    return k;
+}
+
+#if LVTK_DSP_X86
+inline const Kernels& sse2_kernels() noexcept {
+    static const Kernels k = LVTK_DSP_KERNEL_TABLE (sse2, ISA::SSE2);
+    return k;
+}
+
+inline const Kernels& avx2_kernels() noexcept {
+    static const Kernels k = LVTK_DSP_KERNEL_TABLE (avx2, ISA::AVX2);
+    return k;
+}
+
+inline const Kernels& avx512_kernels() noexcept {
+    static const Kernels k = LVTK_DSP_KERNEL_TABLE (avx512, ISA::AVX512);
+    return k;
+}
+#endif
+
+#undef LVTK_DSP_KERNEL_TABLE
+} // namespace detail
+
+/** Returns the kernels for a specific instruction set.
+
+    If `isa` is not compiled in or not supported by the running CPU, the
+    next narrower supported set is returned instead. Check `Kernels::isa`
+    to see what you got.  Mostly useful for testing and benchmarking.
+
+    @ingroup dsp
+ */
+inline const Kernels& kernels (ISA isa) noexcept {
+#if LVTK_DSP_X86
+    switch (isa) {
+        case ISA::AVX512:
+            if (isa_supported (ISA::AVX512))
+                return detail::avx512_kernels();
+            [[fallthrough]];
+        case ISA::AVX2:
+            if (isa_supported (ISA::AVX2))
+                return detail::avx2_kernels();
+            [[fallthrough]];
+        case ISA::SSE2:
+            if (isa_supported (ISA::SSE2))
+                return detail::sse2_kernels();
+            [[fallthrough]];
+        case ISA::SCALAR:
+        default:
+            break;
+    }
+#endif
+    return detail::scalar_kernels();
+}
+
+/** Returns the best kernels for the running CPU.
+
+    CPU detection happens on the first call only.  The returned table is
+    immutable and shared by every instance in the process.
+
+    @ingroup dsp
+ */
+inline const Kernels& kernels() noexcept {
+    static const Kernels& best = kernels (detect_isa());
+    return best;
+}
+
+} // namespace dsp
+} // namespace lvtk
@@ -0,0 +1,344 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace lvtk {
+namespace dsp {
+
+/** Accuracy tiers of the approximations in lvtk::dsp::approx.
+
+    Maximum errors measured against double precision libm, relative for
+    exp2 over [-60, 60], absolute for log2 over [2^-40, 2^40], tanh over
+    [-10, 10] and sin over [-2pi, 2pi].  pow and the decibel conversions
+    inherit the exp2 and log2 errors.
+
+    | Tier   | exp2   | log2   | tanh   | sin    |
+    |--------|--------|--------|--------|--------|
+    | LOW    | 1.0e-4 | 1.2e-5 | 2.4e-2 | 1.3e-4 |
+    | MEDIUM | 3.5e-6 | 2.2e-7 | 1.7e-6 | 1.3e-6 |
+    | HIGH   | 1.0e-7 | 1.1e-7 | 1.3e-7 | 4.5e-7 |
+
+    LOW is meant for meters and control curves, MEDIUM for per-sample
+    modulation, HIGH stays within a few float ulps of libm.
+
+    @ingroup dsp
+    @headerfile lvtk/dsp/math.hpp
+ */
+enum class Accuracy : uint32_t {
+    LOW = 0,
+    MEDIUM,
+    HIGH
+};
+
+/** Branch free approximations of libm functions.
+
+    Everything here is inline, allocation free and written with selects
+    instead of branches, so loops over buffers auto-vectorize (see
+    transform()).  Inputs are not checked for NaN or infinity.  Unlike
+    libm calls, these are also safe to build with -ffast-math.
+
+    @code
+        using namespace lvtk::dsp;
+        const float g = approx::db_to_gain (*db);
+        const float y = approx::tanh<Accuracy::HIGH> (x * drive);
+    @endcode
+
+    @ingroup dsp
+ */
+namespace approx {
+
+/** @private */
+inline float from_bits (uint32_t bits) noexcept {
+    float f;
+    std::memcpy (&f, &bits, sizeof (f));
+    return f;
+}
+
+/** @private */
+inline uint32_t to_bits (float f) noexcept {
+    uint32_t bits;
+    std::memcpy (&bits, &f, sizeof (bits));
+    return bits;
+}
+
+/** @private Round to nearest through the float bit pattern.  No float to
+    int conversion, which GCC will not if-convert with trapping math, and
+    not folded away by -ffast-math.  |x| must be below 2^22.
+ */
+inline int32_t round_to_int (float x) noexcept {
+    return (int32_t) (to_bits (x + 12582912.f) - 0x4b400000u); // 1.5 * 2^23
+}
+
+/** 2^x. Inputs are clamped to [-126, 127]. */
+template <Accuracy A = Accuracy::MEDIUM>
+inline float exp2 (float x) noexcept {
+    x               = x < -126.f ? -126.f : (x > 127.f ? 127.f : x);
+    const int32_t i = round_to_int (x);
+    const float f   = x - (float) i; // [-0.5, 0.5]
+
+    float p;
+    if constexpr (A == Accuracy::LOW) {
+        p = 9.999245570e-01f + f * (6.931367339e-01f + f * (2.426394785e-01f + f * 5.583828295e-02f));
+    } else if constexpr (A == Accuracy::MEDIUM) {
+        p = 1.f + f * (6.931210452e-01f + f * (2.402234904e-01f + f * (5.592197584e-02f + f * 9.666368515e-03f)));
+    } else {
+        p = 1.f + f * (6.931472067e-01f + f * (2.402265092e-01f + f * (5.550327227e-02f + f * (9.618056679e-03f + f * (1.340042818e-03f + f * 1.546144470e-04f)))));
+    }
+
+    return p * from_bits ((uint32_t) (i + 127) << 23);
+}
+
+/** log2(x) for positive, normal x.  Zero returns -127. */
+template <Accuracy A = Accuracy::MEDIUM>
+inline float log2 (float x) noexcept {
+    const uint32_t bits     = to_bits (x);
+    const uint32_t mantissa = bits & 0x007fffff;
+    const int32_t upper     = mantissa > 0x003504f3 ? 1 : 0; // above sqrt (2)
+    const int32_t e         = (int32_t) (bits >> 23 & 0xff) - 127 + upper;
+    const float m           = from_bits (mantissa | (upper ? 0x3f000000u : 0x3f800000u)); // [sqrt(0.5), sqrt(2))
+
+    const float s = (m - 1.f) / (m + 1.f);
+    const float u = s * s;
+    float q;
+    if constexpr (A == Accuracy::LOW) {
+        q = 2.885326232e+00f + u * 9.791030897e-01f;
+    } else if constexpr (A == Accuracy::MEDIUM) {
+        q = 2.885390422e+00f + u * (9.615889467e-01f + u * 5.957596069e-01f);
+    } else {
+        q = 2.885390080e+00f + u * (9.617988388e-01f + u * (5.767151860e-01f + u * 4.317176975e-01f));
+    }
+
+    return (float) e + s * q;
+}
+
+/** x^y for positive x, computed as exp2 (y * log2 (x)) */
+template <Accuracy A = Accuracy::MEDIUM>
+inline float pow (float x, float y) noexcept {
+    return exp2<A> (y * log2<A> (x));
+}
+
+/** Converts decibels to linear gain */
+template <Accuracy A = Accuracy::MEDIUM>
+inline float db_to_gain (float db) noexcept {
+    return exp2<A> (db * 0.166096404744368f); // log2 (10) / 20
+}
+
+/** Converts positive linear gain to decibels */
+template <Accuracy A = Accuracy::MEDIUM>
+inline float gain_to_db (float gain) noexcept {
+    return 6.02059991327962f * log2<A> (gain); // 20 * log10 (2)
+}
+
+/** Hyperbolic tangent. LOW is a rational soft clipper that reaches
+    exactly +-1 at |x| = 3, the others are built on exp2.
+ */
+template <Accuracy A = Accuracy::MEDIUM>
+inline float tanh (float x) noexcept {
+    if constexpr (A == Accuracy::LOW) {
+        x             = x < -3.f ? -3.f : (x > 3.f ? 3.f : x);
+        const float u = x * x;
+        return x * (27.f + u) / (27.f + 9.f * u);
+    } else {
+        x             = x < -9.f ? -9.f : (x > 9.f ? 9.f : x);
+        const float e = exp2<A> (x * 2.88539008177793f); // e^2x
+        return (e - 1.f) / (e + 1.f);
+    }
+}
+
+/** Sine of x radians.  Accurate for |x| below ~1e5, beyond that the
+    float argument itself has too little precision.
+ */
+template <Accuracy A = Accuracy::MEDIUM>
+inline float sin (float x) noexcept {
+    float r = x * 0.159154943091895f; // turns
+    r -= (float) round_to_int (r);     // [-0.5, 0.5]
+    const uint32_t sign = to_bits (r) & 0x80000000u;
+    float a             = from_bits (to_bits (r) ^ sign);
+    const float folded  = 0.5f - a;
+    a                   = a > 0.25f ? folded : a; // [0, 0.25], sin (pi - t) = sin (t)
+
+    const float u = a * a;
+    float q;
+    if constexpr (A == Accuracy::LOW) {
+        q = 6.282629424e+00f + u * (-4.118129749e+01f + u * 7.468507992e+01f);
+    } else if constexpr (A == Accuracy::MEDIUM) {
+        q = 6.283180513e+00f + u * (-4.133924613e+01f + u * (8.140800692e+01f + u * -7.160768011e+01f));
+    } else {
+        q = 6.283185280e+00f + u * (-4.134168061e+01f + u * (8.160247637e+01f + u * (-7.658117264e+01f + u * 3.975982709e+01f)));
+    }
+
+    return from_bits (to_bits (a * q) ^ sign);
+}
+
+/** Cosine of x radians, see sin() */
+template <Accuracy A = Accuracy::MEDIUM>
+inline float cos (float x) noexcept {
+    return sin<A> (x + 1.57079632679490f);
+}
+
+/** dst[i] = fn (src[i]).
+
+    With one of the functions above in `fn` this compiles to SIMD code at
+    -O3 with -fno-trapping-math (implied by -ffast-math).  GCC will not turn
+    the clamps into vector selects otherwise, and the loop stays scalar.
+    `dst` and `src` may be the same.
+
+    @code
+        approx::transform (gains, dbs, n, [] (float db) { return approx::db_to_gain (db); });
+    @endcode
+ */
+template <typename Fn>
+inline void transform (float* dst, const float* src, uint32_t n, Fn&& fn) noexcept {
+    for (uint32_t i = 0; i < n; ++i)
+        dst[i] = fn (src[i]);
+}
+
+} // namespace approx
+
+/** Compile time math for building lookup tables.
+
+    Slow, double precision series expansions usable in constant
+    expressions, where <cmath> is not.  Do not call these at runtime.
+
+    @ingroup dsp
+ */
+namespace cx {
+
+/** Pi */
+constexpr double pi = 3.14159265358979323846;
+
+/** e^x for finite x */
+constexpr double exp (double x) noexcept {
+    int halvings = 0;
+    while (x > 0.5 || x < -0.5) {
+        x *= 0.5;
+        ++halvings;
+    }
+    double term = 1.0, sum = 1.0;
+    for (int i = 1; i < 20; ++i) {
+        term *= x / i;
+        sum += term;
+    }
+    while (halvings-- > 0)
+        sum *= sum;
+    return sum;
+}
+
+/** Natural logarithm of positive, finite x */
+constexpr double log (double x) noexcept {
+    int e = 0;
+    while (x > 2.0) {
+        x *= 0.5;
+        ++e;
+    }
+    while (x < 1.0) {
+        x *= 2.0;
+        --e;
+    }
+    const double s = (x - 1.0) / (x + 1.0);
+    double term = s, sum = 0.0;
+    for (int i = 1; i < 60; i += 2) {
+        sum += term / i;
+        term *= s * s;
+    }
+    return 2.0 * sum + e * 0.693147180559945309417;
+}
+
+/** Sine of x radians */
+constexpr double sin (double x) noexcept {
+    const double turns = x / (2.0 * pi);
+    auto whole         = (double) (long long) turns;
+    whole -= turns < whole ? 1.0 : 0.0;
+    x = (turns - whole) * 2.0 * pi; // [0, 2pi)
+    if (x > pi)
+        x -= 2.0 * pi;
+
+    double term = x, sum = 0.0;
+    for (int i = 1; i < 40; i += 2) {
+        sum += term;
+        term *= -x * x / ((i + 1) * (i + 2));
+    }
+    return sum;
+}
+
+/** Cosine of x radians */
+constexpr double cos (double x) noexcept { return sin (x + 0.5 * pi); }
+
+/** Hyperbolic tangent */
+constexpr double tanh (double x) noexcept {
+    if (x > 20.0)
+        return 1.0;
+    if (x < -20.0)
+        return -1.0;
+    const double e = exp (2.0 * x);
+    return (e - 1.0) / (e + 1.0);
+}
+
+/** 10^(db / 20) */
+constexpr double db_to_gain (double db) noexcept {
+    return exp (db * 0.115129254649702284201); // ln (10) / 20
+}
+
+} // namespace cx
+
+/** A table of N evenly spaced samples of a function, linearly interpolated.
+
+    Tables can be built at compile time from any constexpr callable, e.g.
+    the helpers in lvtk::dsp::cx, so they cost nothing at instantiation.
+
+    @code
+        static constexpr lvtk::dsp::LookupTable<1025> sine {
+            [] (double x) { return lvtk::dsp::cx::sin (x); }, 0.0, 2.0 * lvtk::dsp::cx::pi
+        };
+
+        float y = sine (phase);
+    @endcode
+
+    @tparam N   Number of points including both ends, at least 2
+
+    @ingroup dsp
+    @headerfile lvtk/dsp/math.hpp
+ */
+template <std::size_t N>
+class LookupTable final {
+    static_assert (N >= 2, "a lookup table needs at least two points");
+
+public:
+    /** Sample `fn` at N points across [lo, hi] */
+    template <typename Fn>
+    constexpr LookupTable (Fn&& fn, double lo, double hi)
+        : _lo ((float) lo),
+          _scale ((float) ((double) (N - 1) / (hi - lo))) {
+        for (std::size_t i = 0; i < N; ++i)
+            _data[i] = (float) fn (lo + (hi - lo) * (double) i / (double) (N - 1));
+    }
+
+    /** Returns the number of points */
+    constexpr std::size_t size() const noexcept { return N; }
+
+    /** Returns the point at `index` */
+    constexpr float operator[] (std::size_t index) const noexcept { return _data[index]; }
+
+    /** Returns the interpolated value at x, clamped to the table range */
+    float operator() (float x) const noexcept {
+        float pos = (x - _lo) * _scale;
+        pos       = pos < 0.f ? 0.f : (pos > (float) (N - 1) ? (float) (N - 1) : pos);
+        auto i    = (std::size_t) pos;
+        i         = i > N - 2 ? N - 2 : i;
+        const float frac = pos - (float) i;
+        return _data[i] + frac * (_data[i + 1] - _data[i]);
+    }
+
+private:
+    float _data[N] {};
+    float _lo { 0.f };
+    float _scale { 1.f };
+};
+
+} // namespace dsp
+} // namespace lvtk
@@ -0,0 +1,322 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include <lvtk/dsp/kernels.hpp>
+#include <lvtk/dsp/math.hpp>
+
+namespace lvtk {
+namespace dsp {
+
+/** The curve a Smoother follows towards its target.
+    @ingroup dsp
+    @headerfile lvtk/dsp/smoother.hpp
+ */
+enum class SmoothingType : uint32_t {
+    LINEAR = 0,  ///< Straight line, reaches the target after the ramp time
+    EXPONENTIAL, ///< Constant ratio per frame, e.g. for gains and frequencies
+    ONE_POLE     ///< Low pass, ramp time is the 63% time constant
+};
+
+/** Click-free parameter smoothing.
+
+    A smoother moves from its current value to a target over a ramp time.
+    While moving, values are produced per frame or, when a sub-block size
+    is set, computed exactly once per sub-block and linearly interpolated
+    in between using the SIMD ramp kernels.  Once the target is reached the
+    smoother reports itself settled and the block functions fall through to
+    the constant kernels, so stable parameters cost no per-frame work.  Only
+    prepare() calls libm, everything else is realtime safe.
+
+    EXPONENTIAL needs a current value and target of the same sign and
+    non-zero.  Other transitions (e.g. fading from silence) fall back to a
+    linear ramp of the same length.
+
+    @code
+        smoother.prepare (sample_rate, 0.02, 16);
+        smoother.reset (1.f);
+
+        // in run()
+        smoother.set_target (gain);
+        smoother.apply (dsp, output, input, nframes);
+    @endcode
+
+    @ingroup dsp
+    @headerfile lvtk/dsp/smoother.hpp
+ */
+class Smoother {
+public:
+    /** Smaller distances to the target count as settled (ONE_POLE only) */
+    static constexpr float settle_threshold = 1.0e-5f;
+
+    explicit Smoother (SmoothingType type = SmoothingType::LINEAR) noexcept
+        : _type (type) {}
+
+    /** Returns the smoothing curve */
+    SmoothingType type() const noexcept { return _type; }
+
+    /** Set the ramp time and sub-block size.
+
+        Call from instantiate or activate, this uses libm.  A sub-block of 0
+        or 1 updates every frame.  Larger values trade curve accuracy for
+        SIMD ramps; LINEAR is exact with any sub-block size.
+
+        @param sample_rate  Sample rate in Hz
+        @param seconds      Ramp time or, for ONE_POLE, time constant
+        @param sub_block    Frames between exact curve points
+     */
+    void prepare (double sample_rate, double seconds, uint32_t sub_block = 0) noexcept {
+        const double frames = std::max (1.0, sample_rate * seconds);
+        _ramp_frames        = (uint32_t) std::lround (frames);
+        _sub_block          = std::max (1u, sub_block);
+        _log2_pole          = (float) (-1.0 / (frames * 0.693147180559945));
+        _pole_block         = std::exp (-(double) _sub_block / frames);
+        reset (_target);
+    }
+
+    /** Jump to `value` without smoothing */
+    void reset (float value) noexcept {
+        _current = _target = value;
+        _remaining         = 0;
+        _multiplicative    = false;
+    }
+
+    /** Start moving towards `value`.  Cheap when unchanged, call it every
+        block with the current control value.
+     */
+    void set_target (float value) noexcept {
+        if (value == _target)
+            return;
+        _target = value;
+
+        if (_type == SmoothingType::ONE_POLE) {
+            _remaining = 1; // moving until within settle_threshold
+            return;
+        }
+
+        _remaining      = _ramp_frames;
+        _multiplicative = _type == SmoothingType::EXPONENTIAL
+                          && ((_current > 0.f && _target > 0.f)
+                              || (_current < 0.f && _target < 0.f));
+        if (_multiplicative) {
+            _log2_ratio = approx::log2<Accuracy::HIGH> (_target / _current);
+        } else {
+            _step = ((double) _target - (double) _current) / (double) _ramp_frames;
+        }
+    }
+
+    /** Returns the value the next frame will get */
+    float current() const noexcept { return _current; }
+
+    /** Returns the value being moved towards */
+    float target() const noexcept { return _target; }
+
+    /** Returns true when the target has been reached */
+    bool settled() const noexcept { return _remaining == 0; }
+
+    /** Returns the value for this frame and advances by one */
+    float next() noexcept {
+        const float value = _current;
+        if (_remaining > 0)
+            advance (1);
+        return value;
+    }
+
+    /** Advance by `nframes` without producing output */
+    void skip (uint32_t nframes) noexcept {
+        while (_remaining > 0 && nframes > 0) {
+            const uint32_t todo = std::min (nframes, span());
+            advance (todo);
+            nframes -= todo;
+        }
+    }
+
+    /** Write the next `nframes` values to `dst` */
+    void render (const Kernels& k, float* dst, uint32_t nframes) noexcept {
+        segments (
+            nframes,
+            [&] (uint32_t offset, uint32_t n, float start, float end) {
+                if (start == end)
+                    k.fill (dst + offset, start, n);
+                else
+                    k.ramp (dst + offset, start, end, n);
+            },
+            [&] (uint32_t frame, float value) { dst[frame] = value; });
+    }
+
+    /** Multiply `src` by the smoothed value into `dst`.
+        `dst` and `src` may be the same buffer.
+     */
+    void apply (const Kernels& k, float* dst, const float* src, uint32_t nframes) noexcept {
+        apply (k, &dst, &src, 1, nframes);
+    }
+
+    /** Multiply several channels by the same smoothed value.
+        The smoother advances `nframes`, not `channels * nframes`.
+     */
+    void apply (const Kernels& k, float* const* dst, const float* const* src,
+                uint32_t channels, uint32_t nframes) noexcept {
+        segments (
+            nframes,
+            [&] (uint32_t offset, uint32_t n, float start, float end) {
+                for (uint32_t c = 0; c < channels; ++c) {
+                    if (start == end)
+                        k.gain (dst[c] + offset, src[c] + offset, start, n);
+                    else
+                        k.gain_ramp (dst[c] + offset, src[c] + offset, start, end, n);
+                }
+            },
+            [&] (uint32_t frame, float value) {
+                for (uint32_t c = 0; c < channels; ++c)
+                    dst[c][frame] = src[c][frame] * value;
+            });
+    }
+
+private:
+    SmoothingType _type { SmoothingType::LINEAR };
+    float _current { 0.f };
+    float _target { 0.f };
+    uint32_t _remaining { 0 };
+    uint32_t _ramp_frames { 1 };
+    uint32_t _sub_block { 1 };
+    bool _multiplicative { false };
+    double _step { 0.0 };
+    float _log2_ratio { 0.f };
+    float _log2_pole { 0.f };
+    double _pole_block { 0.0 };
+
+    /** Frames until the next exact curve point */
+    uint32_t span() const noexcept {
+        if (_type == SmoothingType::ONE_POLE)
+            return _sub_block;
+        return _multiplicative ? std::min (_remaining, _sub_block) : _remaining;
+    }
+
+    void advance (uint32_t n) noexcept {
+        if (_type == SmoothingType::ONE_POLE) {
+            const double decay = n == _sub_block ? _pole_block
+                                                 : approx::exp2<Accuracy::HIGH> (_log2_pole * (float) n);
+            const float last   = _current;
+            _current           = (float) (_target + ((double) _current - _target) * decay);
+            // slow curves can stall above the threshold at float precision
+            if (std::fabs (_current - _target) <= settle_threshold || _current == last) {
+                _current   = _target;
+                _remaining = 0;
+            }
+            return;
+        }
+
+        n = std::min (n, _remaining);
+        _remaining -= n;
+        if (_remaining == 0)
+            _current = _target; // no rounding drift at the end of a ramp
+        else if (_multiplicative)
+            _current = _target * approx::exp2<Accuracy::HIGH> (-_log2_ratio * (float) _remaining / (float) _ramp_frames);
+        else
+            _current = (float) (_current + _step * (double) n);
+    }
+
+    /** Splits `nframes` into constant and linear segments.  Curves that
+        are not linear are stepped frame by frame when no sub-block is set.
+     */
+    template <typename Segment, typename Frame>
+    void segments (uint32_t nframes, Segment&& segment, Frame&& frame) noexcept {
+        uint32_t offset = 0;
+        while (offset < nframes) {
+            const float start = _current;
+            if (_remaining == 0) {
+                segment (offset, nframes - offset, start, start);
+                return;
+            }
+
+            const uint32_t todo = std::min (nframes - offset, span());
+            if (todo == 1) {
+                frame (offset++, next());
+                continue;
+            }
+
+            advance (todo);
+            segment (offset, todo, start, _current);
+            offset += todo;
+        }
+    }
+};
+
+/** A Smoother bound to a control port.
+
+    Connect it from `connect_port()` and call update() at the start of
+    `run()`.  The optional transform (e.g. dB to gain) only runs when the
+    port value actually changes.
+
+    @code
+        gain.set_transform ([] (float db) { return db > -90.f ? approx::db_to_gain (db) : 0.f; });
+
+        void connect_port (uint32_t port, void* data) {
+            if (port == 4)
+                gain.connect (data);
+        }
+
+        void run (uint32_t nframes) {
+            gain.update();
+            gain.apply (dsp, output, input, 2, nframes);
+        }
+    @endcode
+
+    @ingroup dsp
+    @headerfile lvtk/dsp/smoother.hpp
+ */
+class ControlSmoother : public Smoother {
+public:
+    /** Maps a port value to the smoothed value */
+    using Transform = float (*) (float);
+
+    using Smoother::Smoother;
+
+    /** Bind to a control port buffer, or nullptr to disconnect */
+    void connect (const void* data) noexcept { _port = static_cast<const float*> (data); }
+
+    /** Set the port value transform, nullptr for identity */
+    void set_transform (Transform transform) noexcept {
+        _transform = transform;
+        _changed   = true;
+    }
+
+    /** Jump straight to the port's current value, e.g. in activate() */
+    void snap() noexcept {
+        if (_port == nullptr)
+            return;
+        _last    = *_port;
+        _changed = false;
+        reset (map (_last));
+    }
+
+    /** Read the port and retarget if its value changed.
+        Returns true when the smoother is still moving.
+     */
+    bool update() noexcept {
+        if (_port != nullptr && (_changed || *_port != _last)) {
+            _last    = *_port;
+            _changed = false;
+            set_target (map (_last));
+        }
+        return ! settled();
+    }
+
+private:
+    const float* _port { nullptr };
+    Transform _transform { nullptr };
+    float _last { 0.f };
+    bool _changed { true };
+
+    float map (float value) const noexcept {
+        return _transform != nullptr ? _transform (value) : value;
+    }
+};
+
+} // namespace dsp
+} // namespace lvtk
@@ -0,0 +1,262 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/ext/atom.hpp>
+#include <lvtk/ext/extension.hpp>
+#include <lvtk/ext/urid.hpp>
+#include <lvtk/ui.hpp>
+
+#include <lv2/patch/patch.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace lvtk {
+
+/** Counters kept by @ref BatchWrites
+    @headerfile lvtk/ext/batch_writes.hpp
+    @ingroup ext
+ */
+struct BatchStats {
+    uint64_t queued  = 0; ///< Calls to UI::write()
+    uint64_t written = 0; ///< Writes made to the host
+    uint64_t merged  = 0; ///< Writes replaced by a later one before flushing
+};
+
+/** Collect UI::write() calls and send them to the host once per idle tick.
+
+    Dragging a knob or browsing presets makes hundreds of writes a second,
+    each one processed by the host and then the plugin.  With this mixin
+    UI::write() only records the change, and flush_writes() passes them on
+    after your idle() returns, or before cleanup().
+
+    - Control values keep only the latest per port, written in the order
+      first changed.
+    - atom:eventTransfer messages which are patch:Set objects keep only the
+      latest per port and patch:property.  This needs the host's URID map
+      feature, without it messages are sent unchanged.
+    - Other messages are sent in order, after the controls.
+
+    With set_tuple_batching (true) all atom:eventTransfer messages for a
+    port are sent as a single atom:Tuple.  Your plugin must unpack it.
+
+    @code
+        class MyUI : public lvtk::UI<MyUI, lvtk::BatchWrites, lvtk::Idle> {
+        public:
+            void knob_moved (float value) {
+                write (Gain, value); // sent at the end of this idle tick
+            }
+        };
+    @endcode
+
+    Without the Idle mixin call flush_writes() from your own timer.
+
+    @tparam I your UI type
+    @headerfile lvtk/ext/batch_writes.hpp
+    @ingroup ext
+ */
+template <class I>
+struct BatchWrites : NullExtension {
+    /** @private */
+    BatchWrites (const FeatureList& features) {
+        Map map;
+        for (const auto& f : features)
+            if (map.set (f))
+                break;
+        if (map) {
+            _event_transfer = map (LV2_ATOM__eventTransfer);
+            _object         = map (LV2_ATOM__Object);
+            _tuple          = map (LV2_ATOM__Tuple);
+            _patch_set      = map (LV2_PATCH__Set);
+            _patch_property = map (LV2_PATCH__property);
+        }
+    }
+
+    /** Send all atom:eventTransfer messages for a port as one atom:Tuple.
+        Requires the URID map feature.  Off by default.
+     */
+    void set_tuple_batching (bool batch) noexcept { _tuples = batch && _tuple != 0; }
+
+    /** Returns true if messages are sent as one atom:Tuple per port */
+    bool tuple_batching() const noexcept { return _tuples; }
+
+    /** Send everything written since the last flush to the host.
+        @returns the number of host writes made
+     */
+    uint32_t flush_writes() {
+        const Controller& controller = static_cast<I*> (this)->controller;
+        uint32_t count               = 0;
+
+        // the host may call port_event() from write(), and the UI write()
+        // again, so take everything pending before the first host write
+        std::vector<uint32_t> dirty;
+        std::vector<Message> messages;
+        std::vector<uint8_t> bytes, tuple;
+        dirty.swap (_dirty);
+        messages.swap (_messages);
+        bytes.swap (_bytes);
+        tuple.swap (_tuple_buffer);
+
+        for (auto port : dirty) {
+            Control& c        = _controls[port];
+            c.pending         = false;
+            const float value = c.value;
+            controller.write (port, sizeof (float), 0, &value);
+            ++count;
+        }
+
+        for (std::size_t i = 0; i < messages.size(); ++i) {
+            const Message& m = messages[i];
+            if (m.dead)
+                continue;
+
+            if (! _tuples || m.protocol != _event_transfer) {
+                controller.write (m.port, m.size, m.protocol, bytes.data() + m.offset);
+                ++count;
+                continue;
+            }
+
+            // this and every later event for the port, in one tuple
+            tuple.resize (sizeof (LV2_Atom));
+            for (std::size_t j = i; j < messages.size(); ++j) {
+                Message& n = messages[j];
+                if (n.dead || n.port != m.port || n.protocol != _event_transfer)
+                    continue;
+                const auto data = bytes.data() + n.offset;
+                tuple.insert (tuple.end(), data, data + n.size);
+                tuple.resize (sizeof (LV2_Atom) + lv2_atom_pad_size ((uint32_t) (tuple.size() - sizeof (LV2_Atom))));
+                if (j != i)
+                    n.dead = true;
+            }
+            auto atom  = reinterpret_cast<LV2_Atom*> (tuple.data());
+            atom->size = (uint32_t) (tuple.size() - sizeof (LV2_Atom));
+            atom->type = _tuple;
+            controller.write (m.port, (uint32_t) tuple.size(), _event_transfer, tuple.data());
+            ++count;
+        }
+
+        // hand the storage back unless writes arrived while flushing
+        dirty.clear();
+        messages.clear();
+        bytes.clear();
+        if (_dirty.empty())
+            _dirty.swap (dirty);
+        if (_messages.empty()) {
+            _messages.swap (messages);
+            _bytes.swap (bytes);
+        }
+        if (_tuple_buffer.empty())
+            _tuple_buffer.swap (tuple);
+
+        _stats.written += count;
+        return count;
+    }
+
+    /** Forget everything written since the last flush */
+    void discard_writes() noexcept {
+        for (auto port : _dirty)
+            _controls[port].pending = false;
+        _dirty.clear();
+        _messages.clear();
+        _bytes.clear();
+    }
+
+    /** Returns the number of writes waiting to be flushed */
+    uint32_t pending_writes() const noexcept {
+        uint32_t count = static_cast<uint32_t> (_dirty.size());
+        for (const auto& m : _messages)
+            count += m.dead ? 0 : 1;
+        return count;
+    }
+
+    /** Returns the write counters */
+    const BatchStats& batch_stats() const noexcept { return _stats; }
+
+    /** Zero the write counters */
+    void reset_batch_stats() noexcept { _stats = {}; }
+
+private:
+    template <class S, template <class> class... E>
+    friend class UI;
+
+    struct Control {
+        float value  = 0.f;
+        bool pending = false;
+    };
+
+    struct Message {
+        uint32_t port, size, protocol, property;
+        std::size_t offset;
+        bool dead;
+    };
+
+    std::vector<Control> _controls;
+    std::vector<uint32_t> _dirty;
+    std::vector<Message> _messages;
+    std::vector<uint8_t> _bytes, _tuple_buffer;
+    BatchStats _stats;
+    bool _tuples = false;
+
+    uint32_t _event_transfer = 0;
+    uint32_t _object         = 0;
+    uint32_t _tuple          = 0;
+    uint32_t _patch_set      = 0;
+    uint32_t _patch_property = 0;
+
+    /** Returns the patch:property of a patch:Set message, or zero */
+    uint32_t set_property (uint32_t size, uint32_t protocol, const void* data) const noexcept {
+        if (_patch_set == 0 || protocol != _event_transfer || size < sizeof (LV2_Atom_Object))
+            return 0;
+        auto obj = static_cast<const LV2_Atom_Object*> (data);
+        if (obj->atom.type != _object || obj->body.otype != _patch_set
+            || sizeof (LV2_Atom) + obj->atom.size > size)
+            return 0;
+        LV2_ATOM_OBJECT_FOREACH (obj, prop) {
+            if (prop->key == _patch_property && prop->value.type != 0
+                && prop->value.size >= sizeof (uint32_t))
+                return *reinterpret_cast<const uint32_t*> (&prop->value + 1);
+        }
+        return 0;
+    }
+
+    void batch_write (uint32_t port, uint32_t size, uint32_t protocol, const void* data) {
+        ++_stats.queued;
+
+        if (protocol == 0 && size == sizeof (float)) {
+            if (port >= _controls.size())
+                _controls.resize (port + 1);
+            Control& c = _controls[port];
+            std::memcpy (&c.value, data, sizeof (float));
+            if (c.pending) {
+                ++_stats.merged;
+            } else {
+                c.pending = true;
+                _dirty.push_back (port);
+            }
+            return;
+        }
+
+        const uint32_t property = set_property (size, protocol, data);
+        if (property != 0) {
+            for (auto& m : _messages) {
+                if (! m.dead && m.port == port && m.property == property) {
+                    m.dead = true;
+                    ++_stats.merged;
+                    break;
+                }
+            }
+        }
+
+        // hosts read messages as atoms, keep each one 64-bit aligned
+        const std::size_t offset = lv2_atom_pad_size ((uint32_t) _bytes.size());
+        _messages.push_back ({ port, size, protocol, property, offset, false });
+        auto bytes = static_cast<const uint8_t*> (data);
+        _bytes.resize (offset);
+        _bytes.insert (_bytes.end(), bytes, bytes + size);
+    }
+};
+
+} // namespace lvtk
@@ -12,6 +12,12 @@
 #ifndef LV2_BUF_SIZE__nominalBlockLength
 #    define LV2_BUF_SIZE__nominalBlockLength LV2_BUF_SIZE_PREFIX "nominalBlockLength"
 #endif
+#ifndef LV2_BUF_SIZE__fixedBlockLength
+#    define LV2_BUF_SIZE__fixedBlockLength LV2_BUF_SIZE_PREFIX "fixedBlockLength"
+#endif
+#ifndef LV2_BUF_SIZE__powerOf2BlockLength
+#    define LV2_BUF_SIZE__powerOf2BlockLength LV2_BUF_SIZE_PREFIX "powerOf2BlockLength"
+#endif
 
 namespace lvtk {
 /** Description of buffer information.
@@ -27,36 +33,67 @@ struct BufferDetails final {
     Optional<uint32_t> max;           /**< <http://lv2plug.in/ns/ext/buf-size#maxBlockLength> */
     Optional<uint32_t> nominal;       /**< <http://lv2plug.in/ns/ext/buf-size#nominalBlockLength> */
     Optional<uint32_t> sequence_size; /**< <http://lv2plug.in/ns/ext/buf-size#sequenceSize> */
+    bool fixed_length = false;        /**< <http://lv2plug.in/ns/ext/buf-size#fixedBlockLength> */
+    bool power_of_two = false;        /**< <http://lv2plug.in/ns/ext/buf-size#powerOf2BlockLength> */
+
+    /** The buf-size option keys, mapped once. */
+    struct Keys {
+        LV2_URID min           = 0;
+        LV2_URID max           = 0;
+        LV2_URID nominal       = 0;
+        LV2_URID sequence_size = 0;
+
+        Keys() = default;
+        explicit Keys (LV2_URID_Map* map)
+            : min (map->map (map->handle, LV2_BUF_SIZE__minBlockLength)),
+              max (map->map (map->handle, LV2_BUF_SIZE__maxBlockLength)),
+              nominal (map->map (map->handle, LV2_BUF_SIZE__nominalBlockLength)),
+              sequence_size (map->map (map->handle, LV2_BUF_SIZE__sequenceSize)) {}
+    };
 
     /** Update with Options. Updates `min`, `max`, and `nominal`, and
         `sequence_size` if found in the Option array
 
-        @param map      Map for getting required LV2_URIDs
+        @param keys     Pre-mapped option keys
         @param options  The Options array to scan. MUST be valid with a
                         zeroed option at the end.
      */
-    void apply_options (LV2_URID_Map* map, const Option* options) {
-        uint32_t minkey = map->map (map->handle, LV2_BUF_SIZE__minBlockLength);
-        uint32_t maxkey = map->map (map->handle, LV2_BUF_SIZE__maxBlockLength);
-        uint32_t nomkey = map->map (map->handle, LV2_BUF_SIZE__nominalBlockLength);
-        uint32_t seqkey = map->map (map->handle, LV2_BUF_SIZE__sequenceSize);
-
+    void apply_options (const Keys& keys, const Option* options) {
         for (uint32_t i = 0;; ++i) {
             const auto& opt = options[i];
             if (opt.key == 0 || opt.value == nullptr)
                 break;
 
-            if (minkey == opt.key)
+            if (keys.min == opt.key)
                 min = *(uint32_t*) opt.value;
-            else if (maxkey == opt.key)
+            else if (keys.max == opt.key)
                 max = *(uint32_t*) opt.value;
-            else if (seqkey == opt.key)
+            else if (keys.sequence_size == opt.key)
                 sequence_size = *(uint32_t*) opt.value;
-            else if (nomkey == opt.key)
+            else if (keys.nominal == opt.key)
                 nominal = *(uint32_t*) opt.value;
         }
     }
 
+    /** Update with Options, mapping the keys first.
+        @see apply_options (const Keys&, const Option*)
+     */
+    void apply_options (LV2_URID_Map* map, const Option* options) {
+        apply_options (Keys (map), options);
+    }
+
+    /** Update `fixed_length` and `power_of_two` from host features.
+        @param feature  A host feature, call once for each.
+        @returns true if the feature was a buf-size property
+     */
+    bool apply_feature (const Feature& feature) {
+        if (feature == LV2_BUF_SIZE__fixedBlockLength)
+            return fixed_length = true;
+        if (feature == LV2_BUF_SIZE__powerOf2BlockLength)
+            return power_of_two = true;
+        return false;
+    }
+
     /** Apply options with two LV2_Feature pointers. */
     void apply_options (const LV2_Feature* const map, const LV2_Feature* const options) {
         apply_options ((LV2_URID_Map*) map->data, (const Option*) options->data);
@@ -76,15 +113,15 @@ struct BufSize : NullExtension {
         Map map;
         OptionsData options;
         for (const auto& f : features) {
+            if (details.apply_feature (f))
+                continue;
             if (! map)
                 map.set (f);
             if (! options)
                 options.set (f);
-            if (map && options) {
-                details.apply_options (map, options);
-                break;
-            }
         }
+        if (map && options)
+            details.apply_options (map, options);
     }
 
     /** Get the buffer details
@@ -0,0 +1,173 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/ext/extension.hpp>
+
+#include <lv2/atom/util.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace lvtk {
+
+/** Counters kept by @ref CoalescePortEvents
+    @headerfile lvtk/ext/coalesce.hpp
+    @ingroup ext
+ */
+struct CoalesceStats {
+    uint64_t received  = 0; ///< Events received from the host
+    uint64_t delivered = 0; ///< Events passed on to port_event()
+    uint64_t merged    = 0; ///< Control values replaced before delivery
+    uint64_t dropped   = 0; ///< Messages lost because the queue was full
+};
+
+/** Deliver host port events once per idle tick instead of as they arrive.
+
+    Hosts forward control changes and atom messages at audio rate, far
+    more often than a UI can usefully redraw.  With this mixin, events are
+    collected as they arrive and your port_event() is called from
+    deliver_port_events(), which the @ref Idle mixin calls right before
+    your idle().
+
+    - Control ports (format 0) keep only their latest value.  Each port
+      is delivered once per tick, in the order first changed.
+    - Everything else, e.g. atom messages, is queued in arrival order and
+      delivered after the controls, each at a 64-bit aligned address.
+      When the queue is full new messages are dropped and counted.
+
+    @code
+        class MyUI : public lvtk::UI<MyUI, lvtk::CoalescePortEvents, lvtk::Idle> {
+        public:
+            MyUI (const lvtk::UIArgs& args) : UI (args) {
+                set_message_queue_capacity (32, 8192);
+            }
+
+            // now called at most once per port per idle tick
+            void port_event (uint32_t port, uint32_t size, uint32_t format, const void* data) { ... }
+        };
+    @endcode
+
+    Without the Idle mixin, call deliver_port_events() from your own timer.
+
+    @tparam I your UI type
+    @headerfile lvtk/ext/coalesce.hpp
+    @ingroup ext
+ */
+template <class I>
+struct CoalescePortEvents : NullExtension {
+    /** @private */
+    CoalescePortEvents (const FeatureList&) {
+        set_message_queue_capacity (64, 16384);
+    }
+
+    /** Limit the messages held between ticks, by count and total bytes.
+        Pending messages are kept if they fit.
+     */
+    void set_message_queue_capacity (uint32_t messages, uint32_t bytes) {
+        _max_messages = messages;
+        _max_bytes    = bytes;
+        _messages.reserve (messages);
+        _delivering_messages.reserve (messages);
+        _bytes.reserve (bytes);
+        _delivering_bytes.reserve (bytes);
+    }
+
+    /** Pass everything collected since the last call to port_event().
+        @returns the number of events delivered
+     */
+    uint32_t deliver_port_events() {
+        auto self      = static_cast<I*> (this);
+        uint32_t count = 0;
+
+        // port_event may write to the host, which may send events back
+        _dirty.swap (_delivering);
+        for (auto port : _delivering) {
+            Control& c        = _controls[port];
+            c.pending         = false;
+            const float value = c.value;
+            self->port_event (port, sizeof (float), 0, &value);
+            ++count;
+        }
+        _delivering.clear();
+
+        _messages.swap (_delivering_messages);
+        _bytes.swap (_delivering_bytes);
+        for (const auto& m : _delivering_messages) {
+            self->port_event (m.port, m.size, m.format, _delivering_bytes.data() + m.offset);
+            ++count;
+        }
+        _delivering_messages.clear();
+        _delivering_bytes.clear();
+
+        _stats.delivered += count;
+        return count;
+    }
+
+    /** Returns the number of events waiting for the next tick */
+    uint32_t pending_port_events() const noexcept {
+        return static_cast<uint32_t> (_dirty.size() + _messages.size());
+    }
+
+    /** Returns the event counters */
+    const CoalesceStats& coalesce_stats() const noexcept { return _stats; }
+
+    /** Zero the event counters */
+    void reset_coalesce_stats() noexcept { _stats = {}; }
+
+private:
+    template <class S, template <class> class... E>
+    friend class UI;
+
+    struct Control {
+        float value  = 0.f;
+        bool pending = false;
+    };
+
+    struct Message {
+        uint32_t port, size, format;
+        std::size_t offset;
+    };
+
+    std::vector<Control> _controls;
+    std::vector<uint32_t> _dirty, _delivering;
+    std::vector<Message> _messages, _delivering_messages;
+    std::vector<uint8_t> _bytes, _delivering_bytes;
+    uint32_t _max_messages = 0;
+    uint32_t _max_bytes    = 0;
+    CoalesceStats _stats;
+
+    void coalesce_port_event (uint32_t port, uint32_t size, uint32_t format, const void* data) {
+        ++_stats.received;
+
+        if (format == 0 && size == sizeof (float)) {
+            if (port >= _controls.size())
+                _controls.resize (port + 1);
+            Control& c = _controls[port];
+            std::memcpy (&c.value, data, sizeof (float));
+            if (c.pending) {
+                ++_stats.merged;
+            } else {
+                c.pending = true;
+                _dirty.push_back (port);
+            }
+            return;
+        }
+
+        // keep every message 64-bit aligned, port_event() reads them as atoms
+        const std::size_t offset = lv2_atom_pad_size ((uint32_t) _bytes.size());
+        if (_messages.size() >= _max_messages || offset + size > _max_bytes) {
+            ++_stats.dropped;
+            return;
+        }
+
+        _messages.push_back ({ port, size, format, offset });
+        auto bytes = static_cast<const uint8_t*> (data);
+        _bytes.resize (offset);
+        _bytes.insert (_bytes.end(), bytes, bytes + size);
+    }
+};
+
+} // namespace lvtk
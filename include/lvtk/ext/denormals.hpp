@@ -0,0 +1,58 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/dsp/denormal.hpp>
+#include <lvtk/ext/extension.hpp>
+
+namespace lvtk {
+
+/** Flush denormals to zero around every run() and work_response().
+
+    Recursive filters decay into denormal numbers during silence, which
+    can cost 10-100x more CPU per operation.  Add this mixin and the
+    plugin's `run()` (and the @ref Worker "Worker's" `work_response()`)
+    execute inside a @ref dsp::DenormalScope.  The host's floating point
+    state is restored before returning to it.
+
+    @code
+        class Reverb : public lvtk::Plugin<Reverb, lvtk::FlushDenormals> {
+        public:
+            Reverb (const lvtk::Args& args) : Plugin (args) {
+                count_denormals (true); // optional diagnostics
+            }
+        };
+    @endcode
+
+    @tparam I your Plugin type
+    @headerfile lvtk/ext/denormals.hpp
+    @ingroup ext
+ */
+template <class I>
+struct FlushDenormals : NullExtension {
+    /** @private */
+    FlushDenormals (const FeatureList&) {}
+
+    /** Enable or disable the diagnostic counters, off by default.
+        Call from instantiate or activate, not concurrently with run().
+     */
+    void count_denormals (bool enabled) noexcept { _counting = enabled; }
+
+    /** Returns the counters.  Only updated while counting is enabled. */
+    const dsp::DenormalStats& denormal_stats() const noexcept { return _stats; }
+
+    /** Zero the counters */
+    void reset_denormal_stats() noexcept { _stats.reset(); }
+
+    /** @private used by Plugin and Worker to enter the scope */
+    dsp::DenormalStats* denormal_scope_stats() noexcept {
+        return _counting ? &_stats : nullptr;
+    }
+
+private:
+    dsp::DenormalStats _stats;
+    bool _counting = false;
+};
+
+} // namespace lvtk
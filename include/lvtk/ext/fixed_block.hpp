@@ -0,0 +1,111 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstdint>
+
+#include <lvtk/ext/bufsize.hpp>
+#include <lvtk/ext/extension.hpp>
+
+namespace lvtk {
+
+/** Route common block lengths to a compile time sized run.
+
+    Add this mixin and define a `run_fixed<N>()` template.  Blocks of 32,
+    64, 128, 256, 512 or 1024 frames call the matching instantiation, so
+    loops over `N` can be fully unrolled and vectorized.  Any other length
+    calls the plain `run (nframes)`.  The choice depends only on
+    `nframes` of each block: it must be a power of two from 32 to 1024.
+    A host advertising `bufsz:fixedBlockLength` or
+    `bufsz:powerOf2BlockLength` does not change that, e.g. a fixed 48 or
+    100 frame host, or a power of two host using 16 or 2048 frames, always
+    calls `run()`.
+
+    @code
+        class Gain : public lvtk::Plugin<Gain, lvtk::FixedBlockRun> {
+        public:
+            Gain (const lvtk::Args& args) : Plugin (args) {}
+
+            template <uint32_t N>
+            void run_fixed() {
+                for (uint32_t i = 0; i < N; ++i)
+                    out[i] = in[i] * gain;
+            }
+
+            void run (uint32_t nframes) { ... }
+        };
+    @endcode
+
+    @tparam I your Plugin type
+    @headerfile lvtk/ext/fixed_block.hpp
+    @ingroup ext
+ */
+template <class I>
+struct FixedBlockRun : NullExtension {
+    /** Smallest block length with a fixed path */
+    static constexpr uint32_t min_fixed_block = 32;
+    /** Largest block length with a fixed path */
+    static constexpr uint32_t max_fixed_block = 1024;
+
+    /** @private */
+    FixedBlockRun (const FeatureList& features) {
+        for (const auto& f : features)
+            _details.apply_feature (f);
+    }
+
+    /** Returns true if the host promised a fixed block length */
+    bool fixed_block_length() const noexcept { return _details.fixed_length; }
+
+    /** Returns true if the host promised power of two block lengths */
+    bool power_of_two_block_length() const noexcept { return _details.power_of_two; }
+
+    /** Returns the number of blocks which took the fixed path */
+    uint64_t fixed_blocks() const noexcept { return _fixed_blocks; }
+
+    /** Returns the number of blocks which called run (nframes) */
+    uint64_t generic_blocks() const noexcept { return _generic_blocks; }
+
+    /** Override as a template to process exactly N frames.  The default
+        calls `run (N)`.
+     */
+    template <uint32_t N>
+    void run_fixed() { static_cast<I*> (this)->run (N); }
+
+    /** @private called by Plugin in place of run() */
+    void fixed_block_process (uint32_t nframes) {
+        auto self = static_cast<I*> (this);
+        switch (nframes) {
+            case 32:
+                self->template run_fixed<32>();
+                break;
+            case 64:
+                self->template run_fixed<64>();
+                break;
+            case 128:
+                self->template run_fixed<128>();
+                break;
+            case 256:
+                self->template run_fixed<256>();
+                break;
+            case 512:
+                self->template run_fixed<512>();
+                break;
+            case 1024:
+                self->template run_fixed<1024>();
+                break;
+            default:
+                ++_generic_blocks;
+                self->run (nframes);
+                return;
+        }
+        ++_fixed_blocks;
+    }
+
+private:
+    BufferDetails _details;
+    uint64_t _fixed_blocks   = 0;
+    uint64_t _generic_blocks = 0;
+};
+
+} // namespace lvtk
@@ -4,11 +4,23 @@
 #pragma once
 
 #include <lvtk/ext/extension.hpp>
+#include <lvtk/trace.hpp>
 
 #include <lv2/ui/ui.h>
 
+#include <type_traits>
+
 namespace lvtk {
 
+template <class I>
+struct BatchWrites; // lvtk/ext/batch_writes.hpp
+template <class I>
+struct CoalescePortEvents; // lvtk/ext/coalesce.hpp
+template <class I>
+struct IdleScheduler; // lvtk/ext/idle_scheduler.hpp
+template <class I>
+struct Options; // lvtk/ext/options.hpp
+
 /** Adds the idle interface to your UI instance
     @headerfile lvtk/ext/idle.hpp
     @ingroup ext
@@ -32,7 +44,22 @@ protected:
     }
 
 private:
-    static int _idle (LV2UI_Handle ui) { return (static_cast<I*> (ui))->idle(); }
+    static int _idle (LV2UI_Handle ui) {
+        LVTK_TRACE_SCOPE (idle, 0);
+        auto self = static_cast<I*> (ui);
+        if constexpr (std::is_base_of<Options<I>, I>::value)
+            self->options_sync();
+        if constexpr (std::is_base_of<CoalescePortEvents<I>, I>::value)
+            self->deliver_port_events();
+        int result = 0;
+        if constexpr (std::is_base_of<IdleScheduler<I>, I>::value)
+            result = self->scheduled_idle ([self]() { return self->idle(); });
+        else
+            result = self->idle();
+        if constexpr (std::is_base_of<BatchWrites<I>, I>::value)
+            self->flush_writes();
+        return result;
+    }
 };
 
 } // namespace lvtk
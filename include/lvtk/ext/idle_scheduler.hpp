@@ -0,0 +1,210 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/ext/extension.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace lvtk {
+
+/** When an idle task runs
+    @headerfile lvtk/ext/idle_scheduler.hpp
+    @ingroup ext
+ */
+enum class IdleTaskMode : uint32_t {
+    ALWAYS       = 0, ///< Every period
+    WHEN_CHANGED = 1  ///< Every period, if invalidated since the last run
+};
+
+/** Counters kept by @ref IdleScheduler
+    @headerfile lvtk/ext/idle_scheduler.hpp
+    @ingroup ext
+ */
+struct IdleStats {
+    uint64_t ticks      = 0; ///< Idle calls from the host
+    uint64_t runs       = 0; ///< Tasks run
+    uint64_t skipped    = 0; ///< Tasks due but unchanged
+    uint64_t busy_ns    = 0; ///< Wall clock time spent in tasks and idle()
+    uint64_t elapsed_ns = 0; ///< Time between the first and last tick
+
+    /** Fraction of wall time spent working, 0 to 1.  Both times come from
+        a steady clock, not CPU time, so a UI thread which is preempted
+        or blocked inside a task counts as busy.
+     */
+    double load() const noexcept {
+        return elapsed_ns > 0 ? static_cast<double> (busy_ns) / static_cast<double> (elapsed_ns) : 0.0;
+    }
+};
+
+/** Run UI work at its own rate instead of on every idle call.
+
+    Hosts call idle as often as they like, and a UI which redraws every
+    time burns CPU for nothing.  Register tasks with the rate they need,
+    meters at 30 Hz or a text readout at 4 Hz, and the @ref Idle mixin
+    runs the ones that are due before calling your idle().  Tasks added
+    with IdleTaskMode::WHEN_CHANGED only run if invalidate_idle_task()
+    was called since their last run.
+
+    @code
+        class MyUI : public lvtk::UI<MyUI, lvtk::Idle, lvtk::IdleScheduler> {
+        public:
+            MyUI (const lvtk::UIArgs& args) : UI (args) {
+                meters = add_idle_task (30.0, [this] { draw_meters(); });
+                text   = add_idle_task (4.0, [this] { draw_text(); }, lvtk::IdleTaskMode::WHEN_CHANGED);
+            }
+
+            void port_event (uint32_t port, uint32_t, uint32_t, const void*) {
+                if (port == Gain)
+                    invalidate_idle_task (text);
+            }
+        };
+    @endcode
+
+    idle_stats() reports how busy the UI is.  Without the Idle mixin call
+    run_idle_tasks() from your own timer, and next_idle_task_due() says
+    how long it may sleep.
+
+    @tparam I your UI type
+    @headerfile lvtk/ext/idle_scheduler.hpp
+    @ingroup ext
+ */
+template <class I>
+struct IdleScheduler : NullExtension {
+    /** @private */
+    IdleScheduler (const FeatureList&) {}
+
+    /** Returns a monotonic time in nanoseconds */
+    static uint64_t idle_clock() noexcept {
+        using namespace std::chrono;
+        return (uint64_t) duration_cast<nanoseconds> (steady_clock::now().time_since_epoch()).count();
+    }
+
+    /** Add a task run `rate` times per second.  It first runs on the next tick.
+        @returns an id for the other task functions
+     */
+    uint32_t add_idle_task (double rate, std::function<void()> task,
+                            IdleTaskMode mode = IdleTaskMode::ALWAYS) {
+        _tasks.push_back ({ std::move (task), period (rate), 0, mode, true, true });
+        return static_cast<uint32_t> (_tasks.size() - 1);
+    }
+
+    /** Change how often a task runs */
+    void set_idle_task_rate (uint32_t task, double rate) noexcept {
+        if (task < _tasks.size())
+            _tasks[task].period = period (rate);
+    }
+
+    /** Pause or resume a task */
+    void set_idle_task_enabled (uint32_t task, bool enabled) noexcept {
+        if (task < _tasks.size())
+            _tasks[task].enabled = enabled;
+    }
+
+    /** Make a IdleTaskMode::WHEN_CHANGED task run when next due */
+    void invalidate_idle_task (uint32_t task) noexcept {
+        if (task < _tasks.size())
+            _tasks[task].dirty = true;
+    }
+
+    /** Run the tasks due at `now`, a time from idle_clock().
+        @returns the number of tasks run
+     */
+    uint32_t run_idle_tasks (uint64_t now) {
+        uint32_t count = 0;
+        // a task may add tasks, which wait for the next tick
+        const std::size_t size = _tasks.size();
+        for (std::size_t i = 0; i < size; ++i) {
+            if (! _tasks[i].enabled || now < _tasks[i].due)
+                continue;
+
+            if (_tasks[i].mode == IdleTaskMode::WHEN_CHANGED && ! _tasks[i].dirty) {
+                ++_stats.skipped;
+            } else {
+                _tasks[i].dirty = false;
+                // hold the callable while it runs, adding can move _tasks
+                auto task = std::move (_tasks[i].task);
+                task();
+                _tasks[i].task = std::move (task);
+                ++count;
+            }
+
+            // don't try to catch up after a stall
+            auto& t = _tasks[i];
+            t.due   = (t.due != 0 && t.due + t.period > now) ? t.due + t.period : now + t.period;
+        }
+        _stats.runs += count;
+        return count;
+    }
+
+    /** Run the tasks due now */
+    uint32_t run_idle_tasks() { return run_idle_tasks (idle_clock()); }
+
+    /** Returns nanoseconds from `now` until a task is due, zero if one is
+        due already.
+     */
+    uint64_t next_idle_task_due (uint64_t now) const noexcept {
+        uint64_t next = UINT64_MAX;
+        for (const auto& t : _tasks) {
+            if (! t.enabled)
+                continue;
+            if (t.due <= now)
+                return 0;
+            next = std::min (next, t.due - now);
+        }
+        return next;
+    }
+
+    /** Returns the scheduler counters */
+    const IdleStats& idle_stats() const noexcept { return _stats; }
+
+    /** Zero the scheduler counters */
+    void reset_idle_stats() noexcept {
+        _stats = {};
+        _first = 0;
+    }
+
+private:
+    template <class>
+    friend struct Idle;
+
+    struct Task {
+        std::function<void()> task;
+        uint64_t period;
+        uint64_t due;
+        IdleTaskMode mode;
+        bool enabled;
+        bool dirty;
+    };
+
+    std::vector<Task> _tasks;
+    IdleStats _stats;
+    uint64_t _first = 0;
+
+    static uint64_t period (double rate) noexcept {
+        return rate > 0.0 ? static_cast<uint64_t> (1.0e9 / rate) : 0;
+    }
+
+    /** Runs due tasks then `idle`, timing both */
+    template <typename Fn>
+    int scheduled_idle (Fn&& idle) {
+        const uint64_t start = idle_clock();
+        if (_first == 0)
+            _first = start;
+        run_idle_tasks (start);
+        const int result   = idle();
+        const uint64_t end = idle_clock();
+
+        ++_stats.ticks;
+        _stats.busy_ns += end - start; // wall clock, includes preemption
+        _stats.elapsed_ns = end - _first;
+        return result;
+    }
+};
+
+} // namespace lvtk
@@ -0,0 +1,151 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/arena.hpp>
+#include <lvtk/ext/bufsize.hpp>
+#include <lvtk/ext/extension.hpp>
+#include <lvtk/plugin.hpp>
+
+namespace lvtk {
+namespace detail {
+/** @private What create_instance() found for the instance being constructed */
+struct ArenaConstruction {
+    Arena* arena                 = nullptr;
+    const BufferDetails* details = nullptr;
+};
+
+/** @private */
+inline ArenaConstruction& arena_construction() noexcept {
+    static thread_local ArenaConstruction s_current;
+    return s_current;
+}
+} // namespace detail
+
+/** Place the plugin instance and its DSP state in one arena.
+
+    Instead of `new`, the plugin object is constructed at the front of a
+    single pre-faulted block of memory.  Buffers and state allocated from
+    arena() in the constructor then sit right next to it, instead of being
+    scattered across the heap, which helps the cache when many instances
+    run one after another.
+
+    Size the arena by declaring a static `arena_options()` in your plugin.
+    It gets the instantiate arguments and the host's buffer details, and
+    returns the bytes needed besides the plugin object itself.
+
+    @code
+        class Delay : public lvtk::Plugin<Delay, lvtk::InstanceArena> {
+        public:
+            static lvtk::ArenaOptions arena_options (const lvtk::Args& args,
+                                                     const lvtk::BufferDetails& details) {
+                lvtk::ArenaOptions opts;
+                opts.size = sizeof (float) * (size_t) (args.sample_rate * 2.0)
+                            + sizeof (float) * details.max.value_or (8192);
+                opts.lock = true;
+                return opts;
+            }
+
+            Delay (const lvtk::Args& args) : Plugin (args) {
+                line    = arena()->make_array<float> ((size_t) (args.sample_rate * 2.0));
+                scratch = arena()->make_array<float> (buffer_details().max.value_or (8192));
+            }
+        };
+    @endcode
+
+    The arena only exists when the host instantiates through the
+    Descriptor.  If mapping fails the instance falls back to the heap and
+    arena() returns nullptr, so check it.
+
+    @tparam I your Plugin type
+    @headerfile lvtk/ext/instance_arena.hpp
+    @ingroup ext
+ */
+template <class I>
+struct InstanceArena : NullExtension {
+    /** @private */
+    InstanceArena (const FeatureList& features)
+        : _arena (detail::arena_construction().arena) {
+        // create_instance() already scanned the features
+        if (const auto details = detail::arena_construction().details)
+            _details = *details;
+        else
+            scan_buffer_details (features, _details);
+    }
+
+    /** Returns the arena holding this instance, or nullptr */
+    Arena* arena() const noexcept { return _arena; }
+
+    /** Returns the host buffer details found at instantiation */
+    const BufferDetails& buffer_details() const noexcept { return _details; }
+
+    /** Override in your plugin to size the arena.  The default reserves
+        nothing besides the plugin object.
+     */
+    static ArenaOptions arena_options (const Args&, const BufferDetails&) { return {}; }
+
+    /** @private used by Plugin to create instances */
+    static I* create_instance (const Args& args) {
+        BufferDetails details;
+        scan_buffer_details (args.features, details);
+
+        ArenaOptions options     = I::arena_options (args, details);
+        const std::size_t object = sizeof (I) + alignment;
+        options.size             = options.size > SIZE_MAX - object ? SIZE_MAX - object : options.size + object;
+
+        Arena* arena = Arena::create (options);
+        if (arena == nullptr) {
+            ConstructingScope scope (nullptr, details);
+            return new I (args);
+        }
+
+        void* mem = arena->allocate (sizeof (I), alignment);
+        ConstructingScope scope (arena, details);
+        try {
+            return new (mem) I (args);
+        } catch (...) {
+            Arena::destroy (arena);
+            throw;
+        }
+    }
+
+    /** @private used by Plugin to delete instances */
+    static void destroy_instance (I* instance) noexcept {
+        Arena* arena = instance->InstanceArena<I>::_arena;
+        if (arena != nullptr && arena->owns (instance)) {
+            instance->~I();
+            Arena::destroy (arena);
+        } else {
+            delete instance;
+        }
+    }
+
+private:
+    static constexpr std::size_t alignment = alignof (I) > Arena::cache_line ? alignof (I) : Arena::cache_line;
+
+    Arena* _arena;
+    BufferDetails _details;
+
+    struct ConstructingScope {
+        ConstructingScope (Arena* a, const BufferDetails& d) { detail::arena_construction() = { a, &d }; }
+        ~ConstructingScope() { detail::arena_construction() = {}; }
+    };
+
+    static void scan_buffer_details (const FeatureList& features, BufferDetails& details) {
+        Map map;
+        OptionsData options;
+        for (const auto& f : features) {
+            if (details.apply_feature (f))
+                continue;
+            if (! map)
+                map.set (f);
+            if (! options)
+                options.set (f);
+        }
+        if (map && options)
+            details.apply_options (map, options);
+    }
+};
+
+} // namespace lvtk
@@ -7,6 +7,14 @@
 
 #include <lv2/log/log.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
 namespace lvtk {
 
 /** Wrapper around LV2_Log_Log
@@ -67,6 +75,7 @@ struct Logger final : FeatureData<LV2_Log_Log> {
     }
 
 private:
+    friend class DeferredLogger;
     uint32_t Entry   = 0;
     uint32_t Error   = 0;
     uint32_t Note    = 0;
@@ -74,6 +83,365 @@ private:
     uint32_t Warning = 0;
 };
 
+/** Realtime safe logging through a @ref Logger.
+
+    Logging from run() must not call the host, which may write to a file or
+    take a lock.  Instead the format string pointer and the arguments are
+    packed into a record in a lock-free ring.  Formatting and passing the
+    message on to the host happen later, when flush() is called from a non
+    realtime thread.  With the @ref Worker mixin this is automatic: pending
+    messages are flushed on the worker thread after each run cycle.
+
+    The format string is stored by pointer, so it must be a string literal.
+    Up to eight arguments of integer, floating point, pointer and `const
+    char*` type are supported.  Strings are stored by pointer too, they must
+    still be valid when flushed.  `*` width and precision are not supported.
+
+    Each format string is a call site.  By default a call site may log ten
+    messages per second, the rest are suppressed.  Messages which don't fit
+    in the ring are dropped.  Both are counted, and reported to the host at
+    the next flush.
+
+    Single producer: log from one realtime thread at a time.
+
+    @code
+        void run (uint32_t nframes) {
+            if (nframes > max_block)
+                rt_log().warning ("block of %u frames too large\n", nframes);
+        }
+    @endcode
+
+    @headerfile lvtk/ext/log.hpp
+    @ingroup utility
+ */
+class DeferredLogger final {
+public:
+    /** Maximum arguments per message */
+    static constexpr uint32_t max_args = 8;
+
+    /** A logger with no ring.  Everything logged is dropped until
+        reserve() is called.
+     */
+    DeferredLogger() = default;
+
+    /** Allocate a ring holding `capacity` messages, rounded up to a power
+        of two.  Not realtime safe, call from instantiate.
+     */
+    void reserve (uint32_t capacity) {
+        uint32_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        _records.reset (new Record[size]);
+        _mask = size - 1;
+        _head.store (0, std::memory_order_relaxed);
+        _tail.store (0, std::memory_order_relaxed);
+    }
+
+    /** Set the host logger to flush to */
+    void set_logger (const Logger* logger) noexcept { _logger = logger; }
+
+    /** Messages allowed per call site and second, 0 for no limit */
+    void set_rate_limit (uint32_t per_second) noexcept { _rate = per_second; }
+
+    /** Queue a message of the given log type URID.
+        @returns false if it was dropped or suppressed
+     */
+    template <typename... Args>
+    bool log (uint32_t type, const char* fmt, Args... args) noexcept {
+        static_assert (sizeof...(Args) <= max_args, "too many log arguments");
+        if (! allow (fmt)) {
+            bump (_suppressed);
+            return false;
+        }
+
+        const uint32_t tail = _tail.load (std::memory_order_relaxed);
+        if (_records == nullptr || tail - _head.load (std::memory_order_acquire) > _mask) {
+            bump (_dropped);
+            return false;
+        }
+
+        Record& rec = _records[tail & _mask];
+        rec.fmt     = fmt;
+        rec.type    = type;
+        rec.count   = 0;
+        (pack (rec, args), ...);
+        _tail.store (tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Queue a log:Error message */
+    template <typename... Args>
+    bool error (const char* fmt, Args... args) noexcept { return log (type (&Logger::Error), fmt, args...); }
+
+    /** Queue a log:Warning message */
+    template <typename... Args>
+    bool warning (const char* fmt, Args... args) noexcept { return log (type (&Logger::Warning), fmt, args...); }
+
+    /** Queue a log:Note message */
+    template <typename... Args>
+    bool note (const char* fmt, Args... args) noexcept { return log (type (&Logger::Note), fmt, args...); }
+
+    /** Queue a log:Trace message */
+    template <typename... Args>
+    bool trace (const char* fmt, Args... args) noexcept { return log (type (&Logger::Trace), fmt, args...); }
+
+    /** Format queued messages and pass them to the host.  Call from a non
+        realtime thread, one at a time.
+        @returns the number of messages written
+     */
+    uint32_t flush() {
+        _flush_pending.store (false, std::memory_order_relaxed);
+        uint32_t written = 0;
+        char text[512];
+
+        uint32_t head       = _head.load (std::memory_order_relaxed);
+        const uint32_t tail = _tail.load (std::memory_order_acquire);
+        for (; head != tail; ++head) {
+            const Record& rec = _records[head & _mask];
+            format (rec, text, sizeof (text));
+            if (_logger != nullptr)
+                _logger->printf (rec.type, "%s", text);
+            ++written;
+        }
+        _head.store (head, std::memory_order_release);
+
+        const uint64_t dropped    = _dropped.load (std::memory_order_relaxed);
+        const uint64_t suppressed = _suppressed.load (std::memory_order_relaxed);
+        if (_logger != nullptr && (dropped != _reported_dropped || suppressed != _reported_suppressed)) {
+            _logger->printf (_logger->Warning,
+                             "lvtk: %llu log messages dropped, %llu rate limited\n",
+                             (unsigned long long) (dropped - _reported_dropped),
+                             (unsigned long long) (suppressed - _reported_suppressed));
+        }
+        _reported_dropped    = dropped;
+        _reported_suppressed = suppressed;
+        return written;
+    }
+
+    /** Returns true if messages are waiting to be flushed */
+    bool pending() const noexcept {
+        return _head.load (std::memory_order_relaxed) != _tail.load (std::memory_order_relaxed);
+    }
+
+    /** Returns the number of messages dropped because the ring was full */
+    uint64_t dropped() const noexcept { return _dropped.load (std::memory_order_relaxed); }
+
+    /** Returns the number of messages suppressed by the rate limit */
+    uint64_t suppressed() const noexcept { return _suppressed.load (std::memory_order_relaxed); }
+
+    /** @private used by Worker to flush on the worker thread.  Calls
+        `schedule (token, size)` if messages are pending and no flush is
+        scheduled yet.  It should return true if the token was sent.
+     */
+    template <typename Schedule>
+    void schedule_flush (Schedule&& schedule) noexcept {
+        if (! pending() || _flush_pending.load (std::memory_order_relaxed))
+            return;
+        _flush_pending.store (true, std::memory_order_relaxed);
+        if (! schedule (flush_token, (uint32_t) sizeof (flush_token)))
+            _flush_pending.store (false, std::memory_order_relaxed);
+    }
+
+    /** @private */
+    static bool is_flush_token (uint32_t size, const void* data) noexcept {
+        return size == sizeof (flush_token) && std::memcmp (data, flush_token, size) == 0;
+    }
+
+private:
+    enum class Tag : uint8_t { INT, UINT, REAL, STRING, POINTER };
+
+    struct Record {
+        const char* fmt;
+        uint32_t type;
+        uint32_t count;
+        Tag tags[max_args];
+        uint8_t widths[max_args]; // bytes of an integer argument
+        union Value {
+            long long i;
+            unsigned long long u;
+            double d;
+            const void* p;
+        } values[max_args];
+    };
+
+    struct Site {
+        const char* fmt;
+        int64_t second;
+        uint32_t count;
+    };
+
+    enum : uint32_t { site_count = 64, probes = 4 };
+    static constexpr char flush_token[] = "lvtk:log:flush";
+
+    std::unique_ptr<Record[]> _records;
+    uint32_t _mask          = 0;
+    const Logger* _logger   = nullptr;
+    uint32_t _rate          = 10;
+    Site _sites[site_count] = {};
+
+    alignas (64) std::atomic<uint32_t> _tail { 0 };
+    std::atomic<uint64_t> _dropped { 0 };
+    std::atomic<uint64_t> _suppressed { 0 };
+    std::atomic<bool> _flush_pending { false };
+    alignas (64) std::atomic<uint32_t> _head { 0 };
+    uint64_t _reported_dropped    = 0;
+    uint64_t _reported_suppressed = 0;
+
+    uint32_t type (uint32_t Logger::*urid) const noexcept {
+        return _logger != nullptr ? _logger->*urid : 0;
+    }
+
+    static void bump (std::atomic<uint64_t>& counter) noexcept {
+        // single writer, no need for a locked add
+        counter.store (counter.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /** Rate limit per call site.  With more busy sites than slots they
+        evict each other, which can only let more messages through.
+     */
+    bool allow (const char* fmt) noexcept {
+        if (_rate == 0)
+            return true;
+        using namespace std::chrono;
+        const int64_t now = duration_cast<seconds> (steady_clock::now().time_since_epoch()).count();
+
+        // probe a few slots for this site, else reuse a stale one
+        const auto hash = (uint32_t) ((uint64_t) reinterpret_cast<uintptr_t> (fmt) * 0x9E3779B97F4A7C15ull >> 32);
+        Site* site      = nullptr;
+        for (uint32_t i = 0; i < probes; ++i) {
+            Site& s = _sites[(hash + i) % site_count];
+            if (s.fmt == fmt) {
+                site = &s;
+                break;
+            }
+            if (site == nullptr && s.second != now)
+                site = &s;
+        }
+        if (site == nullptr)
+            site = &_sites[hash % site_count];
+
+        if (site->fmt != fmt || site->second != now) {
+            site->fmt    = fmt;
+            site->second = now;
+            site->count  = 0;
+        }
+        if (site->count >= _rate)
+            return false;
+        ++site->count;
+        return true;
+    }
+
+    template <typename T>
+    static void pack (Record& rec, T value) noexcept {
+        auto& v = rec.values[rec.count];
+        auto& t = rec.tags[rec.count];
+        auto& w = rec.widths[rec.count];
+        w       = (uint8_t) sizeof (T);
+
+        if constexpr (std::is_enum<T>::value) {
+            pack (rec, static_cast<std::underlying_type_t<T>> (value));
+            return;
+        } else if constexpr (std::is_same<T, const char*>::value || std::is_same<T, char*>::value) {
+            t   = Tag::STRING;
+            v.p = value;
+        } else if constexpr (std::is_pointer<T>::value || std::is_null_pointer<T>::value) {
+            t   = Tag::POINTER;
+            v.p = value;
+        } else if constexpr (std::is_floating_point<T>::value) {
+            t   = Tag::REAL;
+            v.d = (double) value;
+        } else if constexpr (std::is_signed<T>::value) {
+            static_assert (std::is_integral<T>::value, "unsupported log argument type");
+            t   = Tag::INT;
+            v.i = (long long) value;
+        } else {
+            static_assert (std::is_integral<T>::value, "unsupported log argument type");
+            t   = Tag::UINT;
+            v.u = (unsigned long long) value;
+        }
+        ++rec.count;
+    }
+
+    /** printf the record into `out`, one conversion at a time */
+    static void format (const Record& rec, char* out, std::size_t size) noexcept {
+        std::size_t pos = 0;
+        uint32_t arg    = 0;
+        const char* f   = rec.fmt;
+
+        auto append = [&] (int n) {
+            if (n > 0)
+                pos = pos + (std::size_t) n < size ? pos + (std::size_t) n : size - 1;
+        };
+
+        while (*f != '\0' && pos + 1 < size) {
+            if (*f != '%') {
+                out[pos++] = *f++;
+                continue;
+            }
+            if (f[1] == '%') {
+                out[pos++] = '%';
+                f += 2;
+                continue;
+            }
+
+            // copy flags, width and precision, drop length modifiers
+            char spec[32];
+            std::size_t n = 0;
+            spec[n++]     = *f++;
+            while (*f != '\0' && std::strchr ("-+ #0123456789.", *f) != nullptr && n < sizeof (spec) - 4)
+                spec[n++] = *f++;
+            while (*f != '\0' && std::strchr ("hlLqjzt", *f) != nullptr)
+                ++f;
+            const char conv = *f;
+            if (conv == '\0')
+                break;
+            ++f;
+
+            if (arg >= rec.count) {
+                append (std::snprintf (out + pos, size - pos, "%%%c", conv));
+                continue;
+            }
+
+            const auto& v   = rec.values[arg];
+            const auto bits = rec.widths[arg] * 8u;
+            const Tag tag   = rec.tags[arg++];
+            const bool real = std::strchr ("fFeEgGaA", conv) != nullptr;
+            const bool uint = std::strchr ("ouxX", conv) != nullptr;
+
+            if (tag == Tag::STRING && conv == 's') {
+                spec[n++] = 's';
+                spec[n]   = '\0';
+                append (std::snprintf (out + pos, size - pos, spec, v.p != nullptr ? (const char*) v.p : "(null)"));
+            } else if (tag == Tag::STRING || tag == Tag::POINTER) {
+                append (std::snprintf (out + pos, size - pos, "%p", v.p));
+            } else if (real) {
+                spec[n++] = conv;
+                spec[n]   = '\0';
+                const double d = tag == Tag::REAL ? v.d : tag == Tag::INT ? (double) v.i : (double) v.u;
+                append (std::snprintf (out + pos, size - pos, spec, d));
+            } else if (conv == 'c') {
+                spec[n++] = 'c';
+                spec[n]   = '\0';
+                append (std::snprintf (out + pos, size - pos, spec, (int) v.i));
+            } else {
+                spec[n++] = 'l';
+                spec[n++] = 'l';
+                spec[n++] = uint ? conv : 'd';
+                spec[n]   = '\0';
+                if (tag == Tag::REAL)
+                    append (std::snprintf (out + pos, size - pos, spec, (long long) v.d));
+                else if (uint && bits < 64) // like printf, -1 as %x is ffffffff for an int
+                    append (std::snprintf (out + pos, size - pos, spec, v.u & ((1ull << bits) - 1)));
+                else if (uint || tag == Tag::UINT)
+                    append (std::snprintf (out + pos, size - pos, spec, v.u));
+                else
+                    append (std::snprintf (out + pos, size - pos, spec, v.i));
+            }
+        }
+        out[pos] = '\0';
+    }
+};
+
 /** Adds a @ref Logger `log` to your instance.
     
     @tparam Mod Your Plugin or UI type
@@ -98,14 +466,34 @@ struct Log : NullExtension {
             if (n_ok >= 2)
                 break;
         }
+        _rt_log.set_logger (&_logger);
     }
 
     /** Use this logger to log messages with the host. @see Logger */
     Logger& logger() noexcept { return _logger; }
 
+    /** Enable realtime safe logging with rt_log().  Allocates a ring of
+        `capacity` messages, call from the constructor.
+     */
+    void enable_rt_log (uint32_t capacity = 256) {
+        _rt_log.reserve (capacity);
+    }
+
+    /** Use this logger in run().  Drops everything unless enabled with
+        enable_rt_log(). @see DeferredLogger
+     */
+    DeferredLogger& rt_log() noexcept { return _rt_log; }
+
+    /** Pass messages logged with rt_log() to the host.  Not realtime safe.
+        Plugins with the @ref Worker mixin don't need to call this, UIs can
+        call it from idle.
+     */
+    uint32_t flush_log() { return _rt_log.flush(); }
+
 private:
     /** Use this logger to log messages with the host. @see Logger */
     Logger _logger;
+    DeferredLogger _rt_log;
 };
 
 } // namespace lvtk
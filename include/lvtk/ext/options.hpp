@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstring>
+
 #include <lvtk/ext/extension.hpp>
+#include <lvtk/ext/urid.hpp>
 
+#include <lv2/atom/atom.h>
 #include <lv2/options/options.h>
 
 namespace lvtk {
@@ -36,21 +41,148 @@ struct OptionsData final : FeatureData<Option> {
 };
 
 /** Adds support for LV2 options on your instance
+
+    Options changed by the host at runtime can be applied for you.  Declare
+    the ones the plugin cares about with watch_option() in its constructor.
+    The default set() copies their values into a staging area in one pass,
+    and just before the next run() the Plugin publishes them and
+    calls `options_changed()` on your instance.  So a host can change the
+    block length or sample rate without instantiating again.
+
+    A UI gets the same treatment before each idle() callback, so it needs
+    the @ref Idle extension too.  Without it staged values are never
+    published.
+
+    @code
+        class Synth : public lvtk::Plugin<Synth, lvtk::Options> {
+        public:
+            Synth (const lvtk::Args& args) : Plugin (args) {
+                block = watch_option (LV2_BUF_SIZE__nominalBlockLength);
+                // passed at instantiation
+                nominal = option_value<uint32_t> (block, nominal);
+            }
+
+            // audio thread, before run()
+            void options_changed() {
+                if (option_changed (block))
+                    nominal = option_value<uint32_t> (block, nominal);
+            }
+
+        private:
+            int block = -1;
+            uint32_t nominal = 256;
+        };
+    @endcode
+
+    Watched values must be numbers of 8 bytes or less.  Plugins which
+    override set() should call `stage_options()` from it.
+
     @headerfile lvtk/ext/options.hpp
     @ingroup ext
  */
 template <class I>
 struct Options : Extension<I> {
+    /** Maximum number of watched options */
+    static constexpr int max_watched = 32;
+
     /** @private */
     Options (const FeatureList& features) {
-        for (const auto& f : features)
-            if (host_options.set (f))
-                break;
+        Map map;
+        for (const auto& f : features) {
+            if (! host_options)
+                host_options.set (f);
+            if (! map)
+                map.set (f);
+        }
+
+        if (map) {
+            _map         = map.get();
+            _atom_int    = map (LV2_ATOM__Int);
+            _atom_long   = map (LV2_ATOM__Long);
+            _atom_float  = map (LV2_ATOM__Float);
+            _atom_double = map (LV2_ATOM__Double);
+            _atom_bool   = map (LV2_ATOM__Bool);
+        }
     }
 
     /** @returns Options provided by the host or nullptr if not available */
     const Option* options() const { return host_options.get(); }
 
+    /** Watch an option for runtime changes.
+
+        Call from the constructor.  If the host passed this option at
+        instantiation its value is available right away.
+
+        @param key  The option key
+        @returns A slot for option_value(), or -1 if key is 0 or too many
+                 options are watched.
+     */
+    int watch_option (LV2_URID key) {
+        if (key == 0)
+            return -1;
+        for (int i = 0; i < _num_watched; ++i)
+            if (_watched[i].key == key)
+                return i;
+        if (_num_watched == max_watched)
+            return -1;
+
+        const int slot = _num_watched++;
+        auto& w        = _watched[slot];
+        w.key          = key;
+        if (auto opts = options()) {
+            for (auto opt = opts; opt->key != 0 && opt->value != nullptr; ++opt) {
+                if (opt->key == key && opt->size > 0 && opt->size <= sizeof (w.value)) {
+                    std::memcpy (&w.value, opt->value, opt->size);
+                    w.type = opt->type;
+                }
+            }
+        }
+        return slot;
+    }
+
+    /** Watch an option by URI.  Needs the host's URID map feature.
+        @returns The slot or -1
+     */
+    int watch_option (const char* key_uri) {
+        return _map != nullptr ? watch_option (_map->map (_map->handle, key_uri)) : -1;
+    }
+
+    /** Returns true if the slot has a value. */
+    bool option_available (int slot) const noexcept {
+        return slot >= 0 && slot < _num_watched && _watched[slot].type != 0;
+    }
+
+    /** Returns true if the slot changed in the latest options_changed() */
+    bool option_changed (int slot) const noexcept {
+        return slot >= 0 && slot < max_watched && (_changed & (1u << slot)) != 0;
+    }
+
+    /** Returns the current value of a slot as T, converting from the atom
+        Int, Long, Float, Double or Bool type the host used.  Returns
+        `fallback` if the slot is empty or the type isn't a number.
+     */
+    template <typename T>
+    T option_value (int slot, T fallback = T()) const noexcept {
+        if (! option_available (slot))
+            return fallback;
+        const auto& w = _watched[slot];
+        if (w.type == _atom_int || w.type == _atom_bool)
+            return static_cast<T> (read<int32_t> (w.value));
+        if (w.type == _atom_long)
+            return static_cast<T> (read<int64_t> (w.value));
+        if (w.type == _atom_float)
+            return static_cast<T> (read<float> (w.value));
+        if (w.type == _atom_double)
+            return static_cast<T> (read<double> (w.value));
+        return fallback;
+    }
+
+    /** Override to apply changed options.  Called on the audio thread
+        before run(), so it must be realtime safe.  UIs get it on the UI
+        thread before idle().
+     */
+    void options_changed() {}
+
     /** Get the given options.
 
         Each element of the passed options array MUST have type, subject, and
@@ -67,11 +199,61 @@ struct Options : Extension<I> {
     /** Set the given options.
 
         This function is in the "instantiation" LV2 threading class, so no
-        other instance functions may be called concurrently.
+        other instance functions may be called concurrently.  The default
+        stages watched options for the next run().
 
         @returns Bitwise OR of OptionsStatus values.
      */
-    uint32_t set (const Option* opts) const { return LV2_OPTIONS_SUCCESS; }
+    uint32_t set (const Option* opts) {
+        stage_options (opts);
+        return LV2_OPTIONS_SUCCESS;
+    }
+
+    /** Copy watched options from `opts` to the staging area.  Lock-free.
+
+        Call it from set(), which is in the "instantiation" threading class
+        like the LV2 spec says, so it never runs during run().  A value and
+        its type are staged separately, so this must not race with run()
+        from another thread.
+
+        @returns The number of watched options found
+     */
+    uint32_t stage_options (const Option* opts) noexcept {
+        uint32_t found = 0;
+        if (opts == nullptr)
+            return found;
+        for (; opts->key != 0 && opts->value != nullptr; ++opts) {
+            for (int i = 0; i < _num_watched; ++i) {
+                if (_watched[i].key == opts->key) {
+                    if (stage (i, *opts))
+                        ++found;
+                    break;
+                }
+            }
+        }
+        return found;
+    }
+
+    /** @private Publish staged options, called by Plugin before run()
+        and by Idle before idle()
+     */
+    void options_sync() noexcept {
+        _changed = 0;
+        if (_pending.load (std::memory_order_relaxed) == 0)
+            return;
+
+        const uint32_t mask = _pending.exchange (0, std::memory_order_acquire);
+        for (int i = 0; i < _num_watched; ++i) {
+            if ((mask & (1u << i)) == 0)
+                continue;
+            auto& w = _watched[i];
+            w.value = w.staged_value.load (std::memory_order_relaxed);
+            w.type  = w.staged_type.load (std::memory_order_relaxed);
+        }
+        _changed = mask;
+        if (mask != 0)
+            static_cast<I*> (this)->options_changed();
+    }
 
 protected:
     /** @private */
@@ -81,7 +263,44 @@ protected:
     }
 
 private:
+    struct Watched {
+        LV2_URID key   = 0;
+        LV2_URID type  = 0;
+        uint64_t value = 0;
+        std::atomic<LV2_URID> staged_type { 0 };
+        std::atomic<uint64_t> staged_value { 0 };
+    };
+
     OptionsData host_options;
+    LV2_URID_Map* _map    = nullptr;
+    LV2_URID _atom_int    = 0;
+    LV2_URID _atom_long   = 0;
+    LV2_URID _atom_float  = 0;
+    LV2_URID _atom_double = 0;
+    LV2_URID _atom_bool   = 0;
+    Watched _watched[max_watched];
+    int _num_watched  = 0;
+    uint32_t _changed = 0;
+    std::atomic<uint32_t> _pending { 0 };
+
+    template <typename T>
+    static T read (uint64_t bits) noexcept {
+        T value;
+        std::memcpy (&value, &bits, sizeof (T));
+        return value;
+    }
+
+    bool stage (int slot, const Option& opt) noexcept {
+        if (opt.size == 0 || opt.size > sizeof (uint64_t))
+            return false;
+        uint64_t bits = 0;
+        std::memcpy (&bits, opt.value, opt.size);
+        auto& w = _watched[slot];
+        w.staged_value.store (bits, std::memory_order_relaxed);
+        w.staged_type.store (opt.type, std::memory_order_relaxed);
+        _pending.fetch_or (1u << slot, std::memory_order_release);
+        return true;
+    }
 
     static uint32_t _get (LV2_Handle handle, LV2_Options_Option* options) {
         return (static_cast<I*> (handle))->get (options);
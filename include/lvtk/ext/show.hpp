@@ -7,8 +7,13 @@
 
 #include <lv2/ui/ui.h>
 
+#include <type_traits>
+
 namespace lvtk {
 
+template <class I>
+struct VisibleSubscriptions; // lvtk/ext/visible_subscriptions.hpp
+
 /** Adds LV2UI_Show support to your UI instance.  This interface inherits
     from Idle. In other words, don't use Idle + Show together, just use Show.
 
@@ -34,8 +39,20 @@ protected:
     }
 
 private:
-    static int _show (LV2UI_Handle ui) { return (static_cast<I*> (ui))->show(); }
-    static int _hide (LV2UI_Handle ui) { return (static_cast<I*> (ui))->hide(); }
+    static int _show (LV2UI_Handle ui) {
+        auto self = static_cast<I*> (ui);
+        if constexpr (std::is_base_of<VisibleSubscriptions<I>, I>::value)
+            self->set_visible (true);
+        return self->show();
+    }
+
+    static int _hide (LV2UI_Handle ui) {
+        auto self        = static_cast<I*> (ui);
+        const int result = self->hide();
+        if constexpr (std::is_base_of<VisibleSubscriptions<I>, I>::value)
+            self->set_visible (false);
+        return result;
+    }
 };
 
 } // namespace lvtk
@@ -0,0 +1,229 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstdint>
+
+#include <lvtk/dsp/kernels.hpp>
+#include <lvtk/ext/extension.hpp>
+#include <lvtk/ext/urid.hpp>
+#include <lvtk/static_vector.hpp>
+
+#include <lv2/atom/atom.h>
+
+namespace lvtk {
+
+/** Kinds of ports watched by @ref SilenceBypass
+    @headerfile lvtk/ext/silence.hpp
+    @ingroup ext
+ */
+enum class SilencePort : uint32_t {
+    AUDIO_IN = 0, ///< Checked for silence every block
+    AUDIO_OUT,    ///< Cleared while bypassed
+    CONTROL_IN,   ///< Any value change resumes processing
+    ATOM_IN,      ///< Any event resumes processing
+    ATOM_OUT      ///< Written as an empty sequence while bypassed
+};
+
+/** Skip run() while the plugin is processing silence.
+
+    Declare the plugin's ports with watch_port() in its constructor and set
+    how long its output keeps ringing after the input stops.  Once every
+    watched audio input has stayed below the threshold for the tail length,
+    and no control or event input changed, run() is no longer called.  The
+    watched outputs are cleared instead.  The first non-silent input, changed
+    control value or incoming event resumes normal processing in the same
+    block.
+
+    Silence is detected with the SIMD peak kernel in chunks, so active
+    inputs usually exit on the first chunk.
+
+    Not suitable for plugins which make sound without input, e.g. synths
+    driven by anything but a watched event port.
+
+    Every output must be watched, or the host reads whatever was in the
+    buffer.  Atom outputs such as a notify port are watched as ATOM_OUT,
+    which needs the host's URID map feature.  Without it a plugin with an
+    ATOM_OUT port is never bypassed.
+
+    @code
+        class Delay : public lvtk::Plugin<Delay, lvtk::SilenceBypass> {
+        public:
+            Delay (const lvtk::Args& args) : Plugin (args) {
+                watch_port (0, lvtk::SilencePort::AUDIO_IN);
+                watch_port (1, lvtk::SilencePort::AUDIO_OUT);
+                watch_port (2, lvtk::SilencePort::CONTROL_IN);
+                set_silence_tail ((uint32_t) (args.sample_rate * max_delay_seconds));
+            }
+        };
+    @endcode
+
+    @tparam I your Plugin type
+    @headerfile lvtk/ext/silence.hpp
+    @ingroup ext
+ */
+template <class I>
+struct SilenceBypass : NullExtension {
+    /** @private */
+    SilenceBypass (const FeatureList& features) : _dsp (dsp::kernels()) {
+        Map map;
+        for (const auto& f : features)
+            if (map.set (f))
+                break;
+        if (map)
+            _atom_sequence = map (LV2_ATOM__Sequence);
+    }
+
+    /** Watch a port.  Up to 32 ports can be watched, if more are added
+        the plugin is never bypassed.
+     */
+    void watch_port (uint32_t index, SilencePort type) noexcept {
+        for (auto& p : _ports) {
+            if (p.index == index) {
+                p.type = type;
+                return;
+            }
+        }
+        if (! _ports.push_back ({ index, type, nullptr, 0.f }))
+            _unwatched = true;
+    }
+
+    /** Frames to keep running after the inputs fell silent.
+        Use UINT32_MAX to never bypass.  Default is 0.
+     */
+    void set_silence_tail (uint32_t frames) noexcept { _tail = frames; }
+
+    /** Inputs with no sample above this magnitude are silent.
+        Default is 1e-5 (-100 dBFS).
+     */
+    void set_silence_threshold (float threshold) noexcept { _threshold = threshold; }
+
+    /** Returns true if the last block was bypassed */
+    bool silence_bypassed() const noexcept { return _bypassed; }
+
+    /** Returns the number of blocks bypassed since activation */
+    uint64_t silence_bypassed_blocks() const noexcept { return _bypassed_blocks; }
+
+    /** @private called by Plugin::connect_port */
+    void silence_connect (uint32_t index, void* data) noexcept {
+        for (auto& p : _ports) {
+            if (p.index == index) {
+                p.data = data;
+                if (p.type == SilencePort::CONTROL_IN && data != nullptr)
+                    p.last = *static_cast<const float*> (data);
+                break;
+            }
+        }
+    }
+
+    /** @private called by Plugin::activate */
+    void silence_reset() noexcept {
+        _silent_frames   = 0;
+        _bypassed        = false;
+        _bypassed_blocks = 0;
+    }
+
+    /** @private called by Plugin::run.  Returns true if run() should be
+        skipped, in which case the outputs have been cleared.
+     */
+    bool silence_process (uint32_t nframes) noexcept {
+        if (! quiet (nframes)) {
+            _silent_frames = 0;
+            _bypassed      = false;
+            return false;
+        }
+
+        if (_silent_frames < _tail) {
+            // still ringing out, run and count
+            _silent_frames = nframes < _tail - _silent_frames ? _silent_frames + nframes : _tail;
+            _bypassed      = false;
+            return false;
+        }
+
+        if (_tail == UINT32_MAX || _unwatched)
+            return false;
+        if (_atom_sequence == 0)
+            for (const auto& p : _ports)
+                if (p.type == SilencePort::ATOM_OUT)
+                    return false; // can't write an empty sequence
+
+        for (const auto& p : _ports) {
+            if (p.data == nullptr)
+                continue;
+            if (p.type == SilencePort::AUDIO_OUT) {
+                _dsp.clear (static_cast<float*> (p.data), nframes);
+            } else if (p.type == SilencePort::ATOM_OUT) {
+                auto seq       = static_cast<LV2_Atom_Sequence*> (p.data);
+                seq->atom.type = _atom_sequence;
+                seq->atom.size = sizeof (LV2_Atom_Sequence_Body);
+                seq->body.unit = 0;
+                seq->body.pad  = 0;
+            }
+        }
+
+        _bypassed = true;
+        ++_bypassed_blocks;
+        return true;
+    }
+
+private:
+    struct Port {
+        uint32_t index;
+        SilencePort type;
+        void* data;
+        float last;
+    };
+
+    enum : uint32_t { chunk_size = 64 };
+
+    const dsp::Kernels& _dsp;
+    StaticVector<Port, 32> _ports;
+    uint32_t _atom_sequence  = 0;
+    bool _unwatched          = false;
+    uint32_t _tail           = 0;
+    uint32_t _silent_frames  = 0;
+    float _threshold         = 1.0e-5f;
+    bool _bypassed           = false;
+    uint64_t _bypassed_blocks = 0;
+
+    /** True if no watched input carries signal or changes this block.
+        Controls are checked first, they are cheapest.
+     */
+    bool quiet (uint32_t nframes) noexcept {
+        bool result = true;
+        for (auto& p : _ports) {
+            if (p.data == nullptr)
+                continue;
+            if (p.type == SilencePort::CONTROL_IN) {
+                const float value = *static_cast<const float*> (p.data);
+                if (value != p.last) {
+                    p.last = value;
+                    result = false; // keep going, update the others too
+                }
+            } else if (p.type == SilencePort::ATOM_IN) {
+                const auto seq = static_cast<const LV2_Atom_Sequence*> (p.data);
+                if (seq->atom.size > sizeof (LV2_Atom_Sequence_Body))
+                    result = false;
+            }
+        }
+
+        if (! result)
+            return false;
+
+        for (const auto& p : _ports) {
+            if (p.type != SilencePort::AUDIO_IN || p.data == nullptr)
+                continue;
+            const auto audio = static_cast<const float*> (p.data);
+            for (uint32_t offset = 0; offset < nframes; offset += chunk_size) {
+                const uint32_t n = nframes - offset < chunk_size ? nframes - offset : chunk_size;
+                if (_dsp.peak (audio + offset, n) > _threshold)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+} // namespace lvtk
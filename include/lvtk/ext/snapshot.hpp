@@ -0,0 +1,185 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/ext/data_access.hpp>
+#include <lvtk/ext/extension.hpp>
+#include <lvtk/ext/instance_access.hpp>
+#include <lvtk/triple_buffer.hpp>
+
+#include <type_traits>
+
+/** URI of the lvtk snapshot extension
+    @ingroup ext
+ */
+#define LVTK_SNAPSHOT_URI LVTK_ORG "/ns/snapshot"
+/** URI of the SnapshotInterface extension data */
+#define LVTK_SNAPSHOT__interface LVTK_SNAPSHOT_URI "#interface"
+
+namespace lvtk {
+
+/** Extension data returned by plugins with the @ref Snapshots mixin.
+    @headerfile lvtk/ext/snapshot.hpp
+    @ingroup ext
+ */
+struct SnapshotInterface {
+    /** Returns the latest snapshot of `instance`, which stays valid and
+        unchanged until the next call.  nullptr if the plugin publishes
+        nothing.  `size` is set to the size of the snapshot, `updated` to
+        non-zero if it is newer than the one returned by the last call.
+        Call from one UI thread only.
+     */
+    const void* (*read) (LV2_Handle instance, uint32_t* size, int* updated);
+};
+
+/** Publish fixed size snapshots from run() to a UI in the same process.
+
+    Meters, scopes and spectrum displays need the plugin's latest state,
+    not every block of it.  Fill a @ref TripleBuffer in run() and publish
+    it, the UI reads the latest snapshot with @ref SnapshotAccess whenever
+    it likes.  Nothing is copied through the host and neither side locks.
+
+    @code
+        struct Meters { float peak[2]; };
+
+        class Meter : public lvtk::Plugin<Meter, lvtk::Snapshots> {
+        public:
+            Meter (const lvtk::Args& args) : Plugin (args) {
+                set_snapshot_buffer (meters);
+            }
+
+            void run (uint32_t nframes) {
+                auto& m = meters.write_buffer();
+                ...
+                meters.publish();
+            }
+
+        private:
+            lvtk::TripleBuffer<Meters> meters;
+        };
+    @endcode
+
+    @tparam I your Plugin type
+    @headerfile lvtk/ext/snapshot.hpp
+    @ingroup ext
+ */
+template <class I>
+struct Snapshots : Extension<I> {
+    /** @private */
+    Snapshots (const FeatureList&) {}
+
+    /** Publish `buffer` to UIs.  Call from the constructor, the buffer must
+        live as long as the instance.  T must be trivially copyable, the UI
+        may be built separately.
+     */
+    template <typename T>
+    void set_snapshot_buffer (TripleBuffer<T>& buffer) noexcept {
+        static_assert (std::is_trivially_copyable<T>::value,
+                       "snapshots must be trivially copyable");
+        _buffer = &buffer;
+        _size   = sizeof (T);
+        _reader = [] (void* b, int* updated) -> const void* {
+            auto tb  = static_cast<TripleBuffer<T>*> (b);
+            *updated = tb->update() ? 1 : 0;
+            return &tb->read_buffer();
+        };
+    }
+
+protected:
+    /** @private */
+    inline static void map_extension_data (ExtensionMap& dmap) {
+        static const SnapshotInterface _snapshot = { _read };
+        dmap[LVTK_SNAPSHOT__interface]           = &_snapshot;
+    }
+
+private:
+    using Reader = const void* (*) (void*, int*);
+    void* _buffer  = nullptr;
+    uint32_t _size = 0;
+    Reader _reader = nullptr;
+
+    static const void* _read (LV2_Handle instance, uint32_t* size, int* updated) {
+        auto self  = static_cast<Snapshots*> (static_cast<I*> (instance));
+        int fresh  = 0;
+        auto value = self->_reader != nullptr ? self->_reader (self->_buffer, &fresh) : nullptr;
+        if (size != nullptr)
+            *size = value != nullptr ? self->_size : 0;
+        if (updated != nullptr)
+            *updated = fresh;
+        return value;
+    }
+};
+
+/** Read snapshots published by a plugin with @ref Snapshots.
+
+    Needs the host's instance-access and data-access features, so only
+    works when UI and plugin share a process.  Check snapshots_available()
+    and fall back to port events otherwise.
+
+    @code
+        class MeterUI : public lvtk::UI<MeterUI, lvtk::SnapshotAccess, lvtk::Idle> {
+        public:
+            int idle() {
+                bool updated = false;
+                if (auto m = latest_snapshot<Meters> (&updated); m && updated)
+                    repaint (*m);
+                return 0;
+            }
+        };
+    @endcode
+
+    @tparam I your UI type
+    @headerfile lvtk/ext/snapshot.hpp
+    @ingroup ext
+ */
+template <class I>
+struct SnapshotAccess : NullExtension {
+    /** @private */
+    SnapshotAccess (const FeatureList& features) {
+        ExtensionData data;
+        InstanceHandle instance;
+        for (const auto& f : features) {
+            if (! data)
+                data.set (f);
+            if (! instance)
+                instance.set (f);
+        }
+
+        _instance = instance.get();
+        if (data && _instance != nullptr)
+            _interface = static_cast<const SnapshotInterface*> (data.data_access (LVTK_SNAPSHOT__interface));
+    }
+
+    /** Returns true if the plugin and host support snapshots */
+    bool snapshots_available() const noexcept { return _interface != nullptr; }
+
+    /** Returns the latest snapshot, valid until the next call.  nullptr if
+        unavailable or if the plugin publishes a different size.
+        @param updated  Set to true if it changed since the last call
+     */
+    template <typename T>
+    const T* latest_snapshot (bool* updated = nullptr) noexcept {
+        static_assert (std::is_trivially_copyable<T>::value,
+                       "snapshots must be trivially copyable");
+        if (updated != nullptr)
+            *updated = false;
+        if (_interface == nullptr)
+            return nullptr;
+
+        uint32_t size    = 0;
+        int fresh        = 0;
+        const void* data = _interface->read (_instance, &size, &fresh);
+        if (data == nullptr || size != sizeof (T))
+            return nullptr;
+        if (updated != nullptr)
+            *updated = fresh != 0;
+        return static_cast<const T*> (data);
+    }
+
+private:
+    Handle _instance                    = nullptr;
+    const SnapshotInterface* _interface = nullptr;
+};
+
+} // namespace lvtk
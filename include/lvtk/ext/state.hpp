@@ -4,6 +4,7 @@
 #pragma once
 
 #include "lvtk/ext/extension.hpp"
+#include "lvtk/trace.hpp"
 
 #include <lv2/state/state.h>
 
@@ -124,6 +125,7 @@ private:
                                    LV2_State_Handle state_handle,
                                    uint32_t flags,
                                    const LV2_Feature* const* features) {
+        LVTK_TRACE_SCOPE (save, flags);
         auto* const plugin = reinterpret_cast<I*> (instance);
         StateStore store (store_function, state_handle);
         FeatureList flist (features);
@@ -135,6 +137,7 @@ private:
                                       LV2_State_Handle handle,
                                       uint32_t flags,
                                       const LV2_Feature* const* features) {
+        LVTK_TRACE_SCOPE (restore, flags);
         auto* const plugin = static_cast<I*> (instance);
         StateRetrieve retrieve (retrieve_function, handle);
         FeatureList feature_list (features);
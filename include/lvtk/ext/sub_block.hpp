@@ -0,0 +1,217 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstdint>
+
+#include <lvtk/ext/extension.hpp>
+#include <lvtk/static_vector.hpp>
+
+#include <lv2/atom/atom.h>
+#include <lv2/atom/util.h>
+
+namespace lvtk {
+
+/** Kinds of ports split by @ref SubBlocks
+    @headerfile lvtk/ext/sub_block.hpp
+    @ingroup ext
+ */
+enum class SubBlockPort : uint32_t {
+    AUDIO = 0, ///< Audio or CV buffer, input or output.  Advanced per sub-block
+    ATOM_IN    ///< Input event sequence.  Split at event times
+};
+
+/** A slice of the host's block passed to `process()`
+    @headerfile lvtk/ext/sub_block.hpp
+    @ingroup ext
+ */
+struct SubBlock {
+    uint32_t offset;  ///< First frame in the host block
+    uint32_t nframes; ///< Number of frames in this sub-block
+};
+
+/** Events of one input sequence inside the current sub-block.
+
+    Times are still relative to the start of the host block, so every event
+    is at `SubBlock::offset` except in the last sub-block, which also gets
+    events the host stamped past the end of its block.
+
+    @headerfile lvtk/ext/sub_block.hpp
+    @ingroup ext
+ */
+class SubBlockEvents final {
+public:
+    SubBlockEvents() = default;
+    SubBlockEvents (const LV2_Atom_Event* first, const LV2_Atom_Event* last) noexcept
+        : _first (first), _last (last) {}
+
+    /** @private */
+    struct iterator {
+        iterator (const LV2_Atom_Event* e) : event (e) {}
+        const LV2_Atom_Event& operator*() const noexcept { return *event; }
+        const LV2_Atom_Event* operator->() const noexcept { return event; }
+        iterator& operator++() noexcept {
+            event = lv2_atom_sequence_next (event);
+            return *this;
+        }
+        bool operator== (const iterator& o) const noexcept { return event == o.event; }
+        bool operator!= (const iterator& o) const noexcept { return event != o.event; }
+
+    private:
+        const LV2_Atom_Event* event;
+    };
+
+    iterator begin() const noexcept { return iterator (_first); }
+    iterator end() const noexcept { return iterator (_last); }
+    bool empty() const noexcept { return _first == _last; }
+
+private:
+    const LV2_Atom_Event* _first = nullptr;
+    const LV2_Atom_Event* _last  = nullptr;
+};
+
+/** Process the host's block in small, cache resident sub-blocks.
+
+    Declare the audio and event input ports with sub_block_port() in the
+    constructor and implement `process (const SubBlock&)` instead of run().
+    Each host block is cut into sub-blocks of at most sub_block_size()
+    frames, and is also cut wherever an input event occurs, so parameter
+    changes land on the exact frame.  Before each `process()` call the
+    plugin's `connect_port()` is called with the audio buffers advanced to
+    the sub-block, and restored to the host's buffers afterwards.  Use
+    sub_block_events() to read the events of the current sub-block.
+
+    SubBlocks and @ref FixedBlockRun both replace run(), so a plugin can
+    only use one of them.  Using both fails to compile.
+
+    @code
+        class Filter : public lvtk::Plugin<Filter, lvtk::SubBlocks> {
+        public:
+            Filter (const lvtk::Args& args) : Plugin (args) {
+                sub_block_port (0, lvtk::SubBlockPort::AUDIO);
+                sub_block_port (1, lvtk::SubBlockPort::AUDIO);
+                sub_block_port (2, lvtk::SubBlockPort::ATOM_IN);
+                set_sub_block_size (64);
+            }
+
+            void process (const lvtk::SubBlock& block) {
+                for (const auto& ev : sub_block_events (2))
+                    handle (ev);
+                filter.process (in, out, block.nframes);
+            }
+        };
+    @endcode
+
+    @tparam I your Plugin type
+    @headerfile lvtk/ext/sub_block.hpp
+    @ingroup ext
+ */
+template <class I>
+struct SubBlocks : NullExtension {
+    /** @private */
+    SubBlocks (const FeatureList&) {}
+
+    /** Split a port.  Up to 32 ports.  Returns false if full. */
+    bool sub_block_port (uint32_t index, SubBlockPort type) noexcept {
+        for (auto& p : _ports) {
+            if (p.index == index) {
+                p.type = type;
+                return true;
+            }
+        }
+        return _ports.push_back ({ index, type });
+    }
+
+    /** Set the longest sub-block in frames.  Default is 64. */
+    void set_sub_block_size (uint32_t frames) noexcept { _size = frames > 0 ? frames : 1; }
+
+    /** Returns the longest sub-block in frames */
+    uint32_t sub_block_size() const noexcept { return _size; }
+
+    /** Returns the events of an ATOM_IN port in the current sub-block.
+        Empty outside of process() or if the port isn't split.
+     */
+    SubBlockEvents sub_block_events (uint32_t index) const noexcept {
+        for (const auto& p : _ports)
+            if (p.index == index && p.type == SubBlockPort::ATOM_IN)
+                return { p.first, p.last };
+        return {};
+    }
+
+    /** @private called by Plugin::connect_port */
+    void sub_block_connect (uint32_t index, void* data) noexcept {
+        for (auto& p : _ports) {
+            if (p.index == index) {
+                p.data = data;
+                break;
+            }
+        }
+    }
+
+    /** @private called by Plugin in place of run() */
+    void sub_block_process (uint32_t nframes) {
+        auto self = static_cast<I*> (this);
+
+        for (auto& p : _ports) {
+            if (p.type == SubBlockPort::ATOM_IN && p.data != nullptr) {
+                const auto seq = static_cast<const LV2_Atom_Sequence*> (p.data);
+                p.cursor       = lv2_atom_sequence_begin (&seq->body);
+                p.end          = lv2_atom_sequence_end (&seq->body, seq->atom.size);
+            }
+        }
+
+        uint32_t pos = 0;
+        do {
+            uint32_t end = nframes - pos < _size ? nframes : pos + _size;
+            for (const auto& p : _ports) {
+                if (p.cursor == nullptr)
+                    continue;
+                // end before the next event after the first frame
+                for (auto e = p.cursor; e != p.end; e = lv2_atom_sequence_next (e)) {
+                    if (e->time.frames > (int64_t) pos) {
+                        if (e->time.frames < (int64_t) end)
+                            end = (uint32_t) e->time.frames;
+                        break;
+                    }
+                }
+            }
+
+            for (auto& p : _ports) {
+                if (p.cursor != nullptr) {
+                    p.first = p.cursor;
+                    while (p.cursor != p.end && (p.cursor->time.frames < (int64_t) end || end == nframes))
+                        p.cursor = lv2_atom_sequence_next (p.cursor);
+                    p.last = p.cursor;
+                } else if (p.type == SubBlockPort::AUDIO && p.data != nullptr) {
+                    self->connect_port (p.index, static_cast<float*> (p.data) + pos);
+                }
+            }
+
+            self->process (SubBlock { pos, end - pos });
+            pos = end;
+        } while (pos < nframes);
+
+        for (auto& p : _ports) {
+            if (p.type == SubBlockPort::AUDIO && p.data != nullptr)
+                self->connect_port (p.index, p.data);
+            p.cursor = p.end = p.first = p.last = nullptr;
+        }
+    }
+
+private:
+    struct Port {
+        uint32_t index;
+        SubBlockPort type;
+        void* data                   = nullptr;
+        const LV2_Atom_Event* cursor = nullptr;
+        const LV2_Atom_Event* end    = nullptr;
+        const LV2_Atom_Event* first  = nullptr;
+        const LV2_Atom_Event* last   = nullptr;
+    };
+
+    StaticVector<Port, 32> _ports;
+    uint32_t _size = 64;
+};
+
+} // namespace lvtk
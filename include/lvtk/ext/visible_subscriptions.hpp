@@ -0,0 +1,123 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <lvtk/ext/port_subscribe.hpp>
+#include <lvtk/ext/urid.hpp>
+
+#include <lv2/atom/atom.h>
+#include <lv2/patch/patch.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace lvtk {
+
+template <class I>
+struct Show; // lvtk/ext/show.hpp
+
+/** Receive notifications from expensive ports only while the UI is visible.
+
+    Meters and scopes keep the host busy sending events to hidden windows.
+    Register those ports with watch_port() and they are unsubscribed when
+    the @ref Show mixin's hide() is called, and subscribed again on show().
+    After subscribing again a patch:Get is written to the port passed to
+    set_state_request_port(), so the plugin can send its current state.
+
+    This inherits @ref PortSubscribe, so don't use both.  Use it with Show,
+    or call set_visible() yourself, e.g. when your window is minimized.
+    With Show the UI starts hidden, so watched ports are unsubscribed until
+    the host's first show().  Without it the UI starts visible.
+
+    @code
+        class MeterUI : public lvtk::UI<MeterUI, lvtk::Show, lvtk::VisibleSubscriptions> {
+        public:
+            MeterUI (const lvtk::UIArgs& args) : UI (args) {
+                watch_port (PeakL);
+                watch_port (PeakR);
+                set_state_request_port (Control);
+            }
+        };
+    @endcode
+
+    @tparam I your UI type
+    @headerfile lvtk/ext/visible_subscriptions.hpp
+    @ingroup ext
+ */
+template <class I>
+struct VisibleSubscriptions : PortSubscribe<I> {
+    /** @private */
+    VisibleSubscriptions (const FeatureList& features)
+        : PortSubscribe<I> (features) {
+        for (const auto& f : features)
+            if (_map.set (f))
+                break;
+        // the host shows a Show UI when it wants it on screen
+        _visible = ! std::is_base_of<Show<I>, I>::value;
+    }
+
+    /** Only subscribe to `port` while visible.  Use protocol 0 for control
+        ports, or the URID of e.g. atom:eventTransfer.
+     */
+    void watch_port (uint32_t port, uint32_t protocol = 0) {
+        for (const auto& w : _watched)
+            if (w.port == port && w.protocol == protocol)
+                return;
+        _watched.push_back ({ port, protocol });
+        if (! _visible)
+            this->unsubscribe (port, protocol, nullptr);
+    }
+
+    /** Write a patch:Get to `port` each time the UI becomes visible again.
+        Requires the URID map feature.
+     */
+    void set_state_request_port (uint32_t port) noexcept {
+        _request_port = port;
+        _has_request  = true;
+    }
+
+    /** Subscribe or unsubscribe the watched ports.  Called for you by the
+        @ref Show mixin, does nothing if visibility didn't change.
+     */
+    void set_visible (bool visible) {
+        if (visible == _visible)
+            return;
+        _visible = visible;
+
+        for (const auto& w : _watched) {
+            if (visible)
+                this->subscribe (w.port, w.protocol, nullptr);
+            else
+                this->unsubscribe (w.port, w.protocol, nullptr);
+        }
+
+        if (visible && _has_request && _map)
+            request_state();
+    }
+
+    /** Returns false while hidden */
+    bool visible() const noexcept { return _visible; }
+
+private:
+    struct Watch {
+        uint32_t port, protocol;
+    };
+
+    Map _map;
+    std::vector<Watch> _watched;
+    uint32_t _request_port = 0;
+    bool _has_request      = false;
+    bool _visible          = true;
+
+    void request_state() {
+        const LV2_Atom_Object get = {
+            { sizeof (LV2_Atom_Object_Body), _map (LV2_ATOM__Object) },
+            { 0, _map (LV2_PATCH__Get) }
+        };
+        static_cast<I*> (this)->write (_request_port, sizeof (get), _map (LV2_ATOM__eventTransfer), &get);
+    }
+};
+
+} // namespace lvtk
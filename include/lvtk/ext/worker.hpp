@@ -3,11 +3,17 @@
 
 #pragma once
 
+#include <lvtk/ext/denormals.hpp>
 #include <lvtk/ext/extension.hpp>
+#include <lvtk/trace.hpp>
 
 #include <lv2/worker/worker.h>
 
+#include <type_traits>
+
 namespace lvtk {
+template <class I>
+struct Log; // lvtk/ext/log.hpp
 
 /** Alias of LV2_Worker_Status
     @ingroup alias
@@ -146,20 +152,45 @@ private:
                                     LV2_Worker_Respond_Handle handle,
                                     uint32_t size,
                                     const void* data) {
+        LVTK_TRACE_SCOPE (work, size);
+        auto self = static_cast<I*> (instance);
+        if constexpr (std::is_base_of<Log<I>, I>::value) {
+            if (self->rt_log().is_flush_token (size, data)) {
+                self->flush_log();
+                return LV2_WORKER_SUCCESS;
+            }
+        }
+
         WorkerRespond wrsp (instance, respond, handle);
-        return (LV2_Worker_Status) (static_cast<I*> (instance))->work (wrsp, size, data);
+        return (LV2_Worker_Status) self->work (wrsp, size, data);
     }
 
     /** @internal */
     static LV2_Worker_Status _work_response (LV2_Handle instance,
                                              uint32_t size,
                                              const void* body) {
-        return (LV2_Worker_Status) (static_cast<I*> (instance))->work_response (size, body);
+        LVTK_TRACE_SCOPE (work_response, size);
+        auto self = static_cast<I*> (instance);
+        if constexpr (std::is_base_of<FlushDenormals<I>, I>::value) {
+            // runs in the audio thread, same as run()
+            const dsp::DenormalScope scope (self->denormal_scope_stats());
+            return (LV2_Worker_Status) self->work_response (size, body);
+        } else {
+            return (LV2_Worker_Status) self->work_response (size, body);
+        }
     }
 
     /** @internal */
     static LV2_Worker_Status _end_run (LV2_Handle instance) {
-        return (LV2_Worker_Status) (static_cast<I*> (instance))->end_run();
+        LVTK_TRACE_SCOPE (end_run, 0);
+        auto self = static_cast<I*> (instance);
+        if constexpr (std::is_base_of<Log<I>, I>::value) {
+            // hand messages logged this cycle to the worker thread
+            self->rt_log().schedule_flush ([self] (const char* token, uint32_t size) {
+                return self->schedule_work (size, const_cast<char*> (token)) == LV2_WORKER_SUCCESS;
+            });
+        }
+        return (LV2_Worker_Status) self->end_run();
     }
 };
 
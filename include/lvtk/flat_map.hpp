@@ -0,0 +1,115 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include <lv2/urid/urid.h>
+
+#include <lvtk/static_vector.hpp>
+
+namespace lvtk {
+
+/** A map from LV2_URID to V with fixed capacity.
+
+    Entries are kept sorted in a StaticVector, so lookups are a binary
+    search over contiguous memory and nothing is ever allocated.  Good for
+    dispatching on atom types, option keys or patch properties in run().
+
+    @code
+        lvtk::FlatMap<float*, 8> params;
+        params.insert (map_uri (EXAMPLE__gain), &gain);
+        ...
+        if (auto target = params.find (property->body))
+            **target = value;
+    @endcode
+
+    @tparam V mapped type
+    @tparam N capacity
+    @headerfile lvtk/flat_map.hpp
+    @ingroup utility
+ */
+template <typename V, std::size_t N>
+class FlatMap final {
+public:
+    using key_type       = LV2_URID;
+    using mapped_type    = V;
+    using value_type     = std::pair<LV2_URID, V>;
+    using size_type      = std::size_t;
+    using iterator       = value_type*;
+    using const_iterator = const value_type*;
+
+    /** Insert or replace the value for `key`.  Returns false if the key is
+        new and the map is full.
+     */
+    bool insert (LV2_URID key, V value) {
+        auto pos = lower_bound (key);
+        if (pos != _items.end() && pos->first == key) {
+            pos->second = std::move (value);
+            return true;
+        }
+        return _items.insert (pos, value_type (key, std::move (value))) != _items.end();
+    }
+
+    /** Returns the value for `key` or nullptr */
+    V* find (LV2_URID key) noexcept {
+        auto pos = lower_bound (key);
+        return pos != _items.end() && pos->first == key ? &pos->second : nullptr;
+    }
+
+    /** Returns the value for `key` or nullptr */
+    const V* find (LV2_URID key) const noexcept {
+        return const_cast<FlatMap*> (this)->find (key);
+    }
+
+    /** Returns true if `key` is present */
+    bool contains (LV2_URID key) const noexcept { return find (key) != nullptr; }
+
+    /** Remove `key`.  Returns false if it was not present. */
+    bool erase (LV2_URID key) {
+        auto pos = lower_bound (key);
+        if (pos == _items.end() || pos->first != key)
+            return false;
+        _items.erase (pos);
+        return true;
+    }
+
+    /** Remove all entries */
+    void clear() noexcept { _items.clear(); }
+
+    iterator begin() noexcept { return _items.begin(); }
+    iterator end() noexcept { return _items.end(); }
+    const_iterator begin() const noexcept { return _items.begin(); }
+    const_iterator end() const noexcept { return _items.end(); }
+
+    /** Returns the number of entries */
+    size_type size() const noexcept { return _items.size(); }
+    /** Returns true if there are no entries */
+    bool empty() const noexcept { return _items.empty(); }
+    /** Returns true if no more keys fit */
+    bool full() const noexcept { return _items.full(); }
+    /** Returns N */
+    static constexpr size_type capacity() noexcept { return N; }
+
+private:
+    StaticVector<value_type, N> _items;
+
+    iterator lower_bound (LV2_URID key) noexcept {
+        iterator first = _items.begin();
+        size_type count = _items.size();
+        while (count > 0) {
+            const size_type half = count / 2;
+            if (first[half].first < key) {
+                first += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        return first;
+    }
+};
+
+} // namespace lvtk
@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <algorithm>       // for max
 #include <cassert>         // for assert
-#include <cstdlib>         // for free, malloc, realloc
+#include <cstdlib>         // for free, malloc
+#include <new>             // for bad_alloc
 #include <lv2/urid/urid.h> // for LV2_URID
 #include <stdint.h>        // for uint32_t
-#include <string.h>        // for memset
+#include <string.h>        // for memcpy, memset
+#include <utility>         // for move
 
 #include <lv2/options/options.h>
 #include <lvtk/ext/options.hpp>
@@ -19,6 +22,12 @@ namespace lvtk {
     Plugin implementations don't need to use this.  You can, however, use this 
     in an LV2 host to easily provide URID map/unmaping features to plugins.
 
+    Options and the values added with add_value() live in a single block of
+    memory: a few fit inline without allocating, beyond that the block grows
+    geometrically.  Call reserve() up front to allocate exactly once.  Copies
+    own their values too, so one array can be built and then shared by any
+    number of instances.
+
     @headerfile lvtk/options.hpp
     @ingroup options
 */
@@ -66,10 +75,39 @@ public:
      */
     OptionArray() { allocate_empty(); }
 
-    ~OptionArray() {
-        if (allocated && opts != nullptr)
-            std::free (opts);
-        opts = nullptr;
+    /** Copy options and owned values.  Referenced arrays copy the reference. */
+    OptionArray (const OptionArray& o) { copy_from (o); }
+
+    /** Take over another array's memory.  Inline storage is copied. */
+    OptionArray (OptionArray&& o) noexcept { move_from (o); }
+
+    ~OptionArray() { release(); }
+
+    OptionArray& operator= (const OptionArray& o) {
+        if (this != &o) {
+            OptionArray tmp (o);
+            *this = std::move (tmp);
+        }
+        return *this;
+    }
+
+    OptionArray& operator= (OptionArray&& o) noexcept {
+        if (this != &o) {
+            release();
+            move_from (o);
+        }
+        return *this;
+    }
+
+    /** Make room for `num_options` options and `value_bytes` of values
+        added with add_value(), so adding that many never allocates.  Each
+        value is padded to a multiple of 8 bytes.  Does nothing if data is
+        referenced.
+     */
+    OptionArray& reserve (size_type num_options, uint32_t value_bytes = 0) {
+        if (allocated && (num_options + 1 > capacity || value_bytes > value_capacity))
+            relocate (std::max (num_options + 1, capacity), std::max (align (value_bytes), value_capacity));
+        return *this;
     }
 
     /** Add an option. Does nothing if data is referenced */
@@ -77,7 +115,11 @@ public:
         return add (option.context, option.subject, option.key, option.size, option.type, option.value);
     }
 
-    /** Add an option. Does nothing if data is referenced */
+    /** Add an option. Does nothing if data is referenced.
+
+        The value is not copied and must outlive this array.
+        @see add_value
+     */
     OptionArray& add (OptionsContext context,
                       uint32_t subject,
                       LV2_URID key,
@@ -86,18 +128,46 @@ public:
                       const void* value) {
         if (! allocated)
             return *this;
-        opts = (Option*) realloc (opts, ++count * sizeof (Option));
-        memset (&opts[count - 1], 0, sizeof (Option));
-        auto& opt   = opts[count - 2];
+        if (count == capacity)
+            relocate (capacity * 2, value_capacity);
+        auto& opt   = opts[count - 1];
         opt.context = context;
         opt.subject = subject;
         opt.key     = key;
         opt.size    = size;
         opt.type    = type;
         opt.value   = value;
+        memset (&opts[count++], 0, sizeof (Option));
         return *this;
     }
 
+    /** Add an option with a copy of its value stored in this array.
+        Does nothing if data is referenced.
+     */
+    OptionArray& add_value (OptionsContext context,
+                            uint32_t subject,
+                            LV2_URID key,
+                            uint32_t size,
+                            LV2_URID type,
+                            const void* value) {
+        if (! allocated)
+            return *this;
+        const uint32_t needed = value_size + align (size);
+        if (needed > value_capacity || count == capacity)
+            relocate (count == capacity ? capacity * 2 : capacity,
+                      needed > value_capacity ? std::max (needed, value_capacity * 2) : value_capacity);
+        auto data = values() + value_size;
+        memcpy (data, value, size);
+        value_size = needed;
+        return add (context, subject, key, size, type, data);
+    }
+
+    /** Add an option with a copy of `value` stored in this array. */
+    template <typename T>
+    OptionArray& add_value (OptionsContext context, uint32_t subject, LV2_URID key, LV2_URID type, const T& value) {
+        return add_value (context, subject, key, sizeof (T), type, &value);
+    }
+
     /** Returns the number of options stored excluding the zeroed end
         option as per LV2 specifications
      */
@@ -106,6 +176,9 @@ public:
     /** Returns true if empty */
     bool empty() const { return size() == 0; }
 
+    /** Returns the number of options which fit without allocating */
+    size_type options_capacity() const { return allocated ? capacity - 1 : size(); }
+
     /** Access to Ctype LV2_Options_Option* array */
     const_pointer get() const { return opts; }
 
@@ -143,18 +216,109 @@ public:
     iterator end() const { return iterator (opts, size()); }
 
 private:
+    static constexpr uint32_t value_align   = 8;
+    static constexpr uint32_t small_options = 4;
+    static constexpr uint32_t small_values  = 64;
+
+    bool allocated          = false;
+    uint32_t count          = 0;
+    Option* opts            = nullptr;
+    uint32_t capacity       = 0; // options including the end option
+    uint32_t value_size     = 0;
+    uint32_t value_capacity = 0;
+    alignas (Option) unsigned char small[small_options * sizeof (Option) + small_values];
+
+    static uint32_t align (uint32_t size) noexcept { return (size + value_align - 1) & ~(value_align - 1); }
+
+    // values are stored right after the options
+    unsigned char* values() const noexcept { return reinterpret_cast<unsigned char*> (opts + capacity); }
+    bool is_small() const noexcept { return reinterpret_cast<const unsigned char*> (opts) == small; }
+
     inline void allocate_empty() {
         if (count >= 1)
             return;
-        opts = (Option*) malloc (sizeof (Option));
+        opts           = reinterpret_cast<Option*> (small);
+        capacity       = small_options;
+        value_size     = 0;
+        value_capacity = small_values;
         memset (&opts[0], 0, sizeof (Option));
         allocated = true;
         count     = 1;
     }
 
-    bool allocated = false;
-    uint32_t count = 0;
-    Option* opts   = nullptr;
+    /** Move options and values to a block of the given capacities, pointing
+        owned values at their new address.
+     */
+    void relocate (uint32_t new_capacity, uint32_t new_value_capacity) {
+        const size_t bytes = new_capacity * sizeof (Option) + new_value_capacity;
+        auto block         = static_cast<Option*> (std::malloc (bytes));
+        if (block == nullptr)
+            throw std::bad_alloc();
+        copy_into (block, new_capacity);
+        if (! is_small())
+            std::free (opts);
+        opts           = block;
+        capacity       = new_capacity;
+        value_capacity = new_value_capacity;
+    }
+
+    void copy_into (Option* block, uint32_t block_capacity) const noexcept {
+        auto old_values = values();
+        auto new_values = reinterpret_cast<unsigned char*> (block + block_capacity);
+        memcpy (block, opts, count * sizeof (Option));
+        memcpy (new_values, old_values, value_size);
+        for (uint32_t i = 0; i + 1 < count; ++i) {
+            auto value = static_cast<const unsigned char*> (block[i].value);
+            if (value >= old_values && value < old_values + value_size)
+                block[i].value = new_values + (value - old_values);
+        }
+    }
+
+    void copy_from (const OptionArray& o) {
+        if (! o.allocated) {
+            allocated = false;
+            count     = o.count;
+            opts      = o.opts;
+            return;
+        }
+
+        allocate_empty();
+        if (o.count > capacity || o.value_size > value_capacity)
+            relocate (o.count, o.value_size);
+        o.copy_into (opts, capacity);
+        count      = o.count;
+        value_size = o.value_size;
+    }
+
+    void move_from (OptionArray& o) noexcept {
+        if (! o.allocated || ! o.is_small()) {
+            allocated      = o.allocated;
+            count          = o.count;
+            opts           = o.opts;
+            capacity       = o.capacity;
+            value_size     = o.value_size;
+            value_capacity = o.value_capacity;
+        } else {
+            allocate_empty();
+            o.copy_into (opts, capacity);
+            count      = o.count;
+            value_size = o.value_size;
+        }
+
+        o.allocated = false;
+        o.count     = 0;
+        o.opts      = nullptr;
+        o.allocate_empty();
+    }
+
+    void release() noexcept {
+        if (allocated && opts != nullptr && ! is_small())
+            std::free (opts);
+        allocated  = false;
+        opts       = nullptr;
+        count      = 0;
+        value_size = 0;
+    }
 };
 
 } // namespace lvtk
@@ -0,0 +1,163 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace lvtk {
+
+/** A group of related parameters, updated together and read from run()
+    without blocking.
+
+    Setting an EQ band's frequency, gain and Q one port at a time lets
+    run() see a mix of old and new values.  A ParameterBlock is written
+    as a whole by the UI (through InstanceAccess) or from Worker::work(),
+    and run() always reads a complete set.
+
+    It is a sequence lock.  Writers are serialized against each other and
+    never wait for the reader.  The reader retries if a write happens
+    while copying, at most `Retries` times, then keeps using the last
+    complete copy it read, so run() never spins for long.
+
+    @code
+        struct Band { float freq, gain, q; };
+
+        // UI, worker or any other non-realtime thread
+        band.write ({ 1000.f, -3.f, 0.7f });
+        band.modify ([] (Band& b) { b.gain = 6.f; });
+
+        // run()
+        const Band& b = band.read();
+    @endcode
+
+    @tparam T        trivially copyable parameter struct
+    @tparam Retries  attempts made by read() before falling back
+    @headerfile lvtk/parameter_block.hpp
+    @ingroup utility
+ */
+template <typename T, uint32_t Retries = 4>
+class ParameterBlock final {
+    static_assert (std::is_trivially_copyable<T>::value,
+                   "parameter blocks must be trivially copyable");
+    static_assert (Retries > 0, "read() must try at least once");
+
+public:
+    /** Value initializes the parameters */
+    ParameterBlock() : ParameterBlock (T {}) {}
+
+    /** Initializes the parameters to `value` */
+    explicit ParameterBlock (const T& value) {
+        store (value);
+        _last = value;
+    }
+
+    ParameterBlock (const ParameterBlock&)            = delete;
+    ParameterBlock& operator= (const ParameterBlock&) = delete;
+
+    /** Writer: replace all parameters.  Safe from any number of
+        non-realtime threads.
+     */
+    void write (const T& value) noexcept {
+        const uint32_t seq = begin_write();
+        store (value);
+        _seq.store (seq + 2, std::memory_order_release);
+    }
+
+    /** Writer: change some parameters.  `fn` is called with the current
+        values and must not call read() or write() on this block.
+     */
+    template <typename Fn>
+    void modify (Fn&& fn) {
+        const uint32_t seq = begin_write();
+        T value;
+        load (value);
+        fn (value);
+        store (value);
+        _seq.store (seq + 2, std::memory_order_release);
+    }
+
+    /** Reader: copy the current parameters into `value` if no write is in
+        progress and none happens while copying.  Never waits.
+        @returns true if `value` was set
+     */
+    bool try_read (T& value) const noexcept {
+        const uint32_t before = _seq.load (std::memory_order_acquire);
+        if ((before & 1u) != 0)
+            return false;
+        T copy;
+        load (copy);
+        std::atomic_thread_fence (std::memory_order_acquire);
+        if (_seq.load (std::memory_order_relaxed) != before)
+            return false;
+        value = copy;
+        return true;
+    }
+
+    /** Reader: returns the current parameters, or the last complete set if
+        writes kept interrupting.  The reference stays valid until the next
+        call.  Call from one thread only, usually run().
+     */
+    const T& read() noexcept {
+        for (uint32_t i = 0; i < Retries; ++i) {
+            if (try_read (_last)) {
+                _version = _seq.load (std::memory_order_relaxed) >> 1;
+                return _last;
+            }
+        }
+        ++_fallbacks;
+        return _last;
+    }
+
+    /** Reader: number of complete writes seen by the last successful read().
+        Compare to notice when parameters changed.
+     */
+    uint32_t version() const noexcept { return _version; }
+
+    /** Reader: number of times read() fell back to the last complete set */
+    uint32_t fallbacks() const noexcept { return _fallbacks; }
+
+private:
+    using Word = uintptr_t;
+    static constexpr std::size_t num_words = (sizeof (T) + sizeof (Word) - 1) / sizeof (Word);
+
+    alignas (64) std::atomic<uint32_t> _seq { 0 };
+    std::atomic<Word> _words[num_words];
+
+    alignas (64) T _last {};
+    uint32_t _version   = 0;
+    uint32_t _fallbacks = 0;
+
+    uint32_t begin_write() noexcept {
+        uint32_t seq = _seq.load (std::memory_order_relaxed);
+        for (;;) {
+            if ((seq & 1u) == 0
+                && _seq.compare_exchange_weak (seq, seq + 1, std::memory_order_relaxed)) {
+                std::atomic_thread_fence (std::memory_order_release);
+                return seq;
+            }
+            std::this_thread::yield();
+            seq = _seq.load (std::memory_order_relaxed);
+        }
+    }
+
+    void store (const T& value) noexcept {
+        Word words[num_words] = {};
+        std::memcpy (words, &value, sizeof (T));
+        for (std::size_t i = 0; i < num_words; ++i)
+            _words[i].store (words[i], std::memory_order_relaxed);
+    }
+
+    void load (T& value) const noexcept {
+        Word words[num_words];
+        for (std::size_t i = 0; i < num_words; ++i)
+            words[i] = _words[i].load (std::memory_order_relaxed);
+        std::memcpy (&value, words, sizeof (T));
+    }
+};
+
+} // namespace lvtk
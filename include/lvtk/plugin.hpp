@@ -21,13 +21,27 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <lv2/core/lv2.h>
+#include <lvtk/ext/denormals.hpp>
 #include <lvtk/lvtk.hpp>
+#include <lvtk/trace.hpp>
 
 namespace lvtk {
+template <class I>
+struct FixedBlockRun; // lvtk/ext/fixed_block.hpp
+template <class I>
+struct InstanceArena; // lvtk/ext/instance_arena.hpp
+template <class I>
+struct Options; // lvtk/ext/options.hpp
+template <class I>
+struct SilenceBypass; // lvtk/ext/silence.hpp
+template <class I>
+struct SubBlocks; // lvtk/ext/sub_block.hpp
+
 /** A list of LV2_Descriptors. Used internally to manage registered plugins */
 using PluginDescriptors = DescriptorList<LV2_Descriptor>;
 
@@ -162,7 +176,8 @@ struct Args {
     @tparam S   Your super class
     @tparam E   List of Extension mixins
 
-    @see \ref BufSize, \ref Log, \ref Options, \ref ResizePort, \ref State,
+    @see \ref BufSize, \ref FixedBlockRun, \ref FlushDenormals, \ref Log, \ref Options,
+         \ref ResizePort, \ref SilenceBypass, \ref State, \ref SubBlocks,
          \ref URID, \ref Worker,
 
     @headerfile lvtk/plugin.hpp
@@ -253,8 +268,14 @@ private:
                                            double sample_rate,
                                            const char* bundle_path,
                                            const LV2_Feature* const* features) {
+        LVTK_TRACE_SCOPE (instantiate, 0);
         const Args args (sample_rate, bundle_path, features);
-        auto instance = std::unique_ptr<S> (new S (args));
+        S* created = nullptr;
+        if constexpr (std::is_base_of<InstanceArena<S>, S>::value)
+            created = S::create_instance (args);
+        else
+            created = new S (args);
+        auto instance = std::unique_ptr<S, void (*) (S*)> (created, _destroy);
 
         for (const auto& rq : required()) {
             bool provided = false;
@@ -272,24 +293,68 @@ private:
     }
 
     inline static void _activate (LV2_Handle handle) {
-        (static_cast<S*> (handle))->activate();
+        LVTK_TRACE_SCOPE (activate, 0);
+        auto self = static_cast<S*> (handle);
+        if constexpr (std::is_base_of<SilenceBypass<S>, S>::value)
+            self->silence_reset();
+        self->activate();
     }
 
     inline static void _connect_port (LV2_Handle handle, uint32_t port, void* data) {
-        (static_cast<S*> (handle))->connect_port (port, data);
+        LVTK_TRACE_SCOPE (connect_port, port);
+        auto self = static_cast<S*> (handle);
+        if constexpr (std::is_base_of<SilenceBypass<S>, S>::value)
+            self->silence_connect (port, data);
+        if constexpr (std::is_base_of<SubBlocks<S>, S>::value)
+            self->sub_block_connect (port, data);
+        self->connect_port (port, data);
     }
 
     inline static void _run (LV2_Handle handle, uint32_t sample_count) {
-        (static_cast<S*> (handle))->run (sample_count);
+        LVTK_TRACE_SCOPE (run, sample_count);
+        auto self = static_cast<S*> (handle);
+        if constexpr (std::is_base_of<Options<S>, S>::value)
+            self->options_sync();
+        if constexpr (std::is_base_of<SilenceBypass<S>, S>::value) {
+            if (self->silence_process (sample_count))
+                return;
+        }
+
+        if constexpr (std::is_base_of<FlushDenormals<S>, S>::value) {
+            const dsp::DenormalScope scope (self->denormal_scope_stats());
+            _process (self, sample_count);
+        } else {
+            _process (self, sample_count);
+        }
+    }
+
+    inline static void _process (S* self, uint32_t sample_count) {
+        static_assert (! (std::is_base_of<SubBlocks<S>, S>::value && std::is_base_of<FixedBlockRun<S>, S>::value),
+                       "SubBlocks and FixedBlockRun both replace run(), use one of them");
+        if constexpr (std::is_base_of<SubBlocks<S>, S>::value)
+            self->sub_block_process (sample_count);
+        else if constexpr (std::is_base_of<FixedBlockRun<S>, S>::value)
+            self->fixed_block_process (sample_count);
+        else
+            self->run (sample_count);
     }
 
     inline static void _deactivate (LV2_Handle handle) {
+        LVTK_TRACE_SCOPE (deactivate, 0);
         (static_cast<S*> (handle))->deactivate();
     }
 
     inline static void _cleanup (LV2_Handle handle) {
+        LVTK_TRACE_SCOPE (cleanup, 0);
         (static_cast<S*> (handle))->cleanup();
-        delete static_cast<S*> (handle);
+        _destroy (static_cast<S*> (handle));
+    }
+
+    inline static void _destroy (S* self) {
+        if constexpr (std::is_base_of<InstanceArena<S>, S>::value)
+            S::destroy_instance (self);
+        else
+            delete self;
     }
 
     inline static const void* _extension_data (const char* uri) {
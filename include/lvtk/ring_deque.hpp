@@ -0,0 +1,138 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lvtk {
+
+/** A double ended queue with fixed, power of two capacity.
+
+    Elements are stored inline in a ring, so pushing and popping at either
+    end is constant time and never allocates.  Pushing to a full deque
+    fails and returns false.
+
+    Not thread safe: for passing data between threads use a lock-free
+    ring buffer instead.
+
+    @code
+        lvtk::RingDeque<Note, 64> pending;
+        pending.push_back (note);
+        while (! pending.empty() && pending.front().frame < nframes) {
+            play (pending.front());
+            pending.pop_front();
+        }
+    @endcode
+
+    @tparam T element type
+    @tparam N capacity, a power of two
+    @headerfile lvtk/ring_deque.hpp
+    @ingroup utility
+ */
+template <typename T, std::size_t N>
+class RingDeque final {
+    static_assert (N > 0 && (N & (N - 1)) == 0, "RingDeque capacity must be a power of two");
+
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    RingDeque() = default;
+
+    RingDeque (const RingDeque& o) {
+        for (size_type i = 0; i < o.size(); ++i)
+            push_back (o[i]);
+    }
+
+    RingDeque& operator= (const RingDeque& o) {
+        if (this != &o) {
+            clear();
+            for (size_type i = 0; i < o.size(); ++i)
+                push_back (o[i]);
+        }
+        return *this;
+    }
+
+    ~RingDeque() { clear(); }
+
+    /** Construct an element at the back.  Returns nullptr if full. */
+    template <typename... Args>
+    T* emplace_back (Args&&... args) {
+        if (full())
+            return nullptr;
+        T* obj = new (slot (_head + _size)) T (std::forward<Args> (args)...);
+        ++_size;
+        return obj;
+    }
+
+    /** Construct an element at the front.  Returns nullptr if full. */
+    template <typename... Args>
+    T* emplace_front (Args&&... args) {
+        if (full())
+            return nullptr;
+        T* obj = new (slot (_head - 1)) T (std::forward<Args> (args)...);
+        _head  = (_head - 1) & mask;
+        ++_size;
+        return obj;
+    }
+
+    /** Append to the back.  Returns false if full. */
+    bool push_back (T value) { return emplace_back (std::move (value)) != nullptr; }
+
+    /** Prepend to the front.  Returns false if full. */
+    bool push_front (T value) { return emplace_front (std::move (value)) != nullptr; }
+
+    /** Remove the front element.  Must not be empty. */
+    void pop_front() noexcept {
+        slot (_head)->~T();
+        _head = (_head + 1) & mask;
+        --_size;
+    }
+
+    /** Remove the back element.  Must not be empty. */
+    void pop_back() noexcept {
+        --_size;
+        slot (_head + _size)->~T();
+    }
+
+    /** Destroy all elements */
+    void clear() noexcept {
+        while (_size > 0)
+            pop_back();
+        _head = 0;
+    }
+
+    /** Access by position from the front */
+    T& operator[] (size_type i) noexcept { return *slot (_head + i); }
+    const T& operator[] (size_type i) const noexcept { return *slot (_head + i); }
+
+    T& front() noexcept { return *slot (_head); }
+    const T& front() const noexcept { return *slot (_head); }
+    T& back() noexcept { return *slot (_head + _size - 1); }
+    const T& back() const noexcept { return *slot (_head + _size - 1); }
+
+    /** Returns the number of elements */
+    size_type size() const noexcept { return _size; }
+    /** Returns true if there are no elements */
+    bool empty() const noexcept { return _size == 0; }
+    /** Returns true if no more elements fit */
+    bool full() const noexcept { return _size == N; }
+    /** Returns N */
+    static constexpr size_type capacity() noexcept { return N; }
+
+private:
+    static constexpr size_type mask = N - 1;
+
+    alignas (T) unsigned char _storage[sizeof (T) * N];
+    size_type _head = 0;
+    size_type _size = 0;
+
+    T* slot (size_type i) noexcept { return reinterpret_cast<T*> (_storage) + (i & mask); }
+    const T* slot (size_type i) const noexcept { return reinterpret_cast<const T*> (_storage) + (i & mask); }
+};
+
+} // namespace lvtk
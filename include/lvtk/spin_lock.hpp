@@ -4,15 +4,47 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 
 #include <lvtk/lvtk.h>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#endif
+
 namespace lvtk {
+namespace detail {
+
+/** @private Hint to the CPU that this is a spin-wait loop. */
+inline void spin_pause() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || defined(__arm__))
+    __asm__ __volatile__ ("yield");
+#endif
+}
+
+} // namespace detail
 
-/** A simple spin lock using std::atomic.
-    
-    In order to use this as header-only, you also must include 
-    <lvtk/spin_lock.ipp> in an implementation file to compile platform 
+/** Contention counters of a SpinLock or SharedSpinLock.
+    @headerfile lvtk/spin_lock.hpp
+ */
+struct SpinLockStats {
+    uint64_t contended = 0; ///< Acquisitions which had to wait
+    uint64_t yields    = 0; ///< Times lock() gave up the CPU
+    uint64_t timeouts  = 0; ///< try_lock_for() calls which failed
+};
+
+/** A spin lock using std::atomic.
+
+    lock() spins on a plain load with a CPU pause and exponential backoff,
+    then yields to the scheduler.  On the audio thread use try_lock() or
+    try_lock_for(), which never yield.
+
+    In order to use this as header-only, you also must include
+    <lvtk/spin_lock.ipp> in an implementation file to compile platform
     specific code.
  */
 class LVTK_API SpinLock {
@@ -25,19 +57,146 @@ public:
     void lock() const noexcept;
     /** Lock immediately or return false. (realtime)*/
     inline bool try_lock() const noexcept { return try_lock (0, 1); }
+
+    /** Spin at most `spins` pauses for the lock, then return false.
+        Never yields or sleeps. (realtime)
+     */
+    inline bool try_lock_for (int spins) const noexcept {
+        if (try_lock())
+            return true;
+        _stats.contended.fetch_add (1, std::memory_order_relaxed);
+        for (int i = 0; i < spins; ++i) {
+            detail::spin_pause();
+            if (! locked() && try_lock())
+                return true;
+        }
+        _stats.timeouts.fetch_add (1, std::memory_order_relaxed);
+        return false;
+    }
+
     /** Unlock the mutex. Note this does not check lock status. */
-    inline void unlock() const noexcept { _lock = 0; }
+    inline void unlock() const noexcept { _lock.store (0, std::memory_order_release); }
     /** Returns true if the mutex is locked. */
-    inline bool locked() const noexcept { return _lock.load() == 1; }
+    inline bool locked() const noexcept { return _lock.load (std::memory_order_relaxed) == 1; }
+
+    /** Returns the contention counters. */
+    SpinLockStats stats() const noexcept { return _stats.get(); }
+    /** Zero the contention counters. */
+    void reset_stats() const noexcept { _stats.reset(); }
+
+    /** @private */
+    struct Counters {
+        std::atomic<uint64_t> contended { 0 }, yields { 0 }, timeouts { 0 };
+
+        SpinLockStats get() const noexcept {
+            SpinLockStats s;
+            s.contended = contended.load (std::memory_order_relaxed);
+            s.yields    = yields.load (std::memory_order_relaxed);
+            s.timeouts  = timeouts.load (std::memory_order_relaxed);
+            return s;
+        }
+
+        void reset() noexcept {
+            contended.store (0, std::memory_order_relaxed);
+            yields.store (0, std::memory_order_relaxed);
+            timeouts.store (0, std::memory_order_relaxed);
+        }
+    };
 
 private:
     mutable std::atomic<int> _lock { 0 };
+    mutable Counters _stats;
     /** @internal */
     inline bool try_lock (int c, int v) const noexcept {
-        return _lock.compare_exchange_strong (c, v);
+        return _lock.compare_exchange_strong (c, v, std::memory_order_acquire, std::memory_order_relaxed);
     }
 
     LVTK_DISABLE_COPY (SpinLock)
 };
 
+/** A reader/writer spin lock.
+
+    Any number of readers, or one writer.  Writers blocked in lock() are
+    counted, and while any wait no new readers enter, so readers can't
+    starve them.  Up to 127 writers may wait at once.  Like SpinLock,
+    only the try_ variants are realtime safe, and lock() and lock_shared()
+    are compiled by <lvtk/spin_lock.ipp>.
+ */
+class LVTK_API SharedSpinLock {
+public:
+    inline SharedSpinLock()  = default;
+    inline ~SharedSpinLock() = default;
+
+    /** Lock exclusively or yield until locked. (non realtime) */
+    void lock() const noexcept;
+    /** Lock exclusively now or return false. (realtime) */
+    inline bool try_lock() const noexcept {
+        uint32_t s = _state.load (std::memory_order_relaxed);
+        return (s & ~waiting) == 0
+               && _state.compare_exchange_strong (s, s | writer, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+    /** Spin at most `spins` pauses for an exclusive lock. (realtime) */
+    inline bool try_lock_for (int spins) const noexcept {
+        return spin_for (spins, [this] { return try_lock(); });
+    }
+    /** Release an exclusive lock. */
+    inline void unlock() const noexcept { _state.fetch_and (~writer, std::memory_order_release); }
+
+    /** Lock shared or yield until locked. (non realtime) */
+    void lock_shared() const noexcept;
+    /** Lock shared now or return false.  Fails while a writer holds or
+        waits for the lock. (realtime)
+     */
+    inline bool try_lock_shared() const noexcept {
+        uint32_t s = _state.load (std::memory_order_relaxed);
+        while ((s & (writer | waiting)) == 0)
+            if (_state.compare_exchange_weak (s, s + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        return false;
+    }
+    /** Spin at most `spins` pauses for a shared lock. (realtime) */
+    inline bool try_lock_shared_for (int spins) const noexcept {
+        return spin_for (spins, [this] { return try_lock_shared(); });
+    }
+    /** Release a shared lock. */
+    inline void unlock_shared() const noexcept { _state.fetch_sub (1, std::memory_order_release); }
+
+    /** Returns true if a writer holds the lock. */
+    inline bool locked() const noexcept { return (_state.load (std::memory_order_relaxed) & writer) != 0; }
+    /** Returns the number of readers holding the lock. */
+    inline uint32_t readers() const noexcept { return _state.load (std::memory_order_relaxed) & ~(writer | waiting); }
+    /** Returns the number of writers waiting in lock(). */
+    inline uint32_t writers_waiting() const noexcept { return (_state.load (std::memory_order_relaxed) & waiting) / waiter; }
+
+    /** Returns the contention counters. */
+    SpinLockStats stats() const noexcept { return _stats.get(); }
+    /** Zero the contention counters. */
+    void reset_stats() const noexcept { _stats.reset(); }
+
+private:
+    // bit 31 the writer, 24..30 writers waiting, 0..23 readers
+    static constexpr uint32_t writer  = 1u << 31;
+    static constexpr uint32_t waiter  = 1u << 24;
+    static constexpr uint32_t waiting = 0x7fu << 24;
+
+    mutable std::atomic<uint32_t> _state { 0 };
+    mutable SpinLock::Counters _stats;
+
+    template <class Try>
+    inline bool spin_for (int spins, Try&& attempt) const noexcept {
+        if (attempt())
+            return true;
+        _stats.contended.fetch_add (1, std::memory_order_relaxed);
+        for (int i = 0; i < spins; ++i) {
+            detail::spin_pause();
+            if (attempt())
+                return true;
+        }
+        _stats.timeouts.fetch_add (1, std::memory_order_relaxed);
+        return false;
+    }
+
+    LVTK_DISABLE_COPY (SharedSpinLock)
+};
+
 } // namespace lvtk
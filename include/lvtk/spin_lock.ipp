@@ -15,22 +15,79 @@
 #endif
 
 namespace lvtk {
+namespace detail {
 
-void SpinLock::lock() const noexcept {
-    if (try_lock())
-        return;
+/** @private Pause with exponential backoff, then yield to the scheduler. */
+class SpinBackoff {
+public:
+    explicit SpinBackoff (SpinLock::Counters& stats) noexcept : _stats (stats) {}
 
-    for (int i = 20; --i >= 0;)
-        if (try_lock())
+    void operator()() noexcept {
+        if (_pauses <= max_pauses) {
+            for (int i = 0; i < _pauses; ++i)
+                spin_pause();
+            _pauses <<= 1;
             return;
+        }
 
-    while (! try_lock()) {
+        _stats.yields.fetch_add (1, std::memory_order_relaxed);
 #if _WIN32
         Sleep (0);
 #else
         sched_yield();
 #endif
     }
+
+private:
+    static constexpr int max_pauses = 64;
+    SpinLock::Counters& _stats;
+    int _pauses = 1;
+};
+
+} // namespace detail
+
+void SpinLock::lock() const noexcept {
+    if (try_lock())
+        return;
+
+    _stats.contended.fetch_add (1, std::memory_order_relaxed);
+    detail::SpinBackoff backoff (_stats);
+    for (;;) {
+        // spin on a plain load so waiters don't bounce the cache line
+        while (locked())
+            backoff();
+        if (try_lock())
+            return;
+    }
+}
+
+void SharedSpinLock::lock() const noexcept {
+    if (try_lock())
+        return;
+
+    _stats.contended.fetch_add (1, std::memory_order_relaxed);
+    detail::SpinBackoff backoff (_stats);
+    // counted as waiting until acquired, other waiters stay counted
+    _state.fetch_add (waiter, std::memory_order_relaxed);
+    for (;;) {
+        uint32_t s = _state.load (std::memory_order_relaxed);
+        if ((s & ~waiting) == 0) {
+            if (_state.compare_exchange_weak (s, (s - waiter) | writer, std::memory_order_acquire, std::memory_order_relaxed))
+                return;
+            continue;
+        }
+        backoff();
+    }
+}
+
+void SharedSpinLock::lock_shared() const noexcept {
+    if (try_lock_shared())
+        return;
+
+    _stats.contended.fetch_add (1, std::memory_order_relaxed);
+    detail::SpinBackoff backoff (_stats);
+    while (! try_lock_shared())
+        backoff();
 }
 
 } // namespace lvtk
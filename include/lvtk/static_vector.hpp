@@ -0,0 +1,172 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lvtk {
+
+/** A vector with fixed capacity and inline storage.
+
+    Elements live inside the object, so it never allocates and can be
+    filled and emptied from run().  Adding to a full vector fails instead
+    of growing: push_back() returns false and emplace_back() nullptr.
+
+    @code
+        lvtk::StaticVector<Voice*, 16> active;
+        if (! active.push_back (voice))
+            steal_oldest();
+    @endcode
+
+    @tparam T element type
+    @tparam N capacity
+    @headerfile lvtk/static_vector.hpp
+    @ingroup utility
+ */
+template <typename T, std::size_t N>
+class StaticVector final {
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    StaticVector() = default;
+
+    StaticVector (std::initializer_list<T> init) {
+        for (const auto& v : init)
+            if (! push_back (v))
+                break;
+    }
+
+    StaticVector (const StaticVector& o) {
+        for (const auto& v : o)
+            push_back (v);
+    }
+
+    StaticVector (StaticVector&& o) noexcept (std::is_nothrow_move_constructible<T>::value) {
+        for (auto& v : o)
+            emplace_back (std::move (v));
+        o.clear();
+    }
+
+    ~StaticVector() { clear(); }
+
+    StaticVector& operator= (const StaticVector& o) {
+        if (this != &o) {
+            clear();
+            for (const auto& v : o)
+                push_back (v);
+        }
+        return *this;
+    }
+
+    StaticVector& operator= (StaticVector&& o) noexcept (std::is_nothrow_move_constructible<T>::value) {
+        if (this != &o) {
+            clear();
+            for (auto& v : o)
+                emplace_back (std::move (v));
+            o.clear();
+        }
+        return *this;
+    }
+
+    /** Construct an element at the end.  Returns nullptr if full. */
+    template <typename... Args>
+    T* emplace_back (Args&&... args) {
+        if (_size == N)
+            return nullptr;
+        T* obj = new (data() + _size) T (std::forward<Args> (args)...);
+        ++_size;
+        return obj;
+    }
+
+    /** Append a copy.  Returns false if full. */
+    bool push_back (const T& value) { return emplace_back (value) != nullptr; }
+
+    /** Append by moving.  Returns false if full. */
+    bool push_back (T&& value) { return emplace_back (std::move (value)) != nullptr; }
+
+    /** Remove the last element.  Must not be empty. */
+    void pop_back() noexcept {
+        --_size;
+        data()[_size].~T();
+    }
+
+    /** Insert before `pos`, shifting the rest up.  Returns the inserted
+        element or end() if full.
+     */
+    iterator insert (const_iterator pos, T value) {
+        const auto index = static_cast<size_type> (pos - begin());
+        if (emplace_back (std::move (value)) == nullptr)
+            return end();
+        for (size_type i = _size - 1; i > index; --i)
+            std::swap (data()[i], data()[i - 1]);
+        return begin() + index;
+    }
+
+    /** Remove the element at `pos`, shifting the rest down. */
+    iterator erase (const_iterator pos) {
+        const auto index = static_cast<size_type> (pos - begin());
+        for (size_type i = index; i + 1 < _size; ++i)
+            data()[i] = std::move (data()[i + 1]);
+        pop_back();
+        return begin() + index;
+    }
+
+    /** Remove the element at `pos` by moving the last one into its place.
+        Constant time, but does not keep the order.
+     */
+    void swap_remove (const_iterator pos) {
+        const auto index = static_cast<size_type> (pos - begin());
+        if (index + 1 != _size)
+            data()[index] = std::move (back());
+        pop_back();
+    }
+
+    /** Destroy all elements */
+    void clear() noexcept {
+        while (_size > 0)
+            pop_back();
+    }
+
+    T& operator[] (size_type i) noexcept { return data()[i]; }
+    const T& operator[] (size_type i) const noexcept { return data()[i]; }
+
+    T& front() noexcept { return data()[0]; }
+    const T& front() const noexcept { return data()[0]; }
+    T& back() noexcept { return data()[_size - 1]; }
+    const T& back() const noexcept { return data()[_size - 1]; }
+
+    T* data() noexcept { return reinterpret_cast<T*> (_storage); }
+    const T* data() const noexcept { return reinterpret_cast<const T*> (_storage); }
+
+    iterator begin() noexcept { return data(); }
+    iterator end() noexcept { return data() + _size; }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator end() const noexcept { return data() + _size; }
+
+    /** Returns the number of elements */
+    size_type size() const noexcept { return _size; }
+    /** Returns true if there are no elements */
+    bool empty() const noexcept { return _size == 0; }
+    /** Returns true if no more elements fit */
+    bool full() const noexcept { return _size == N; }
+    /** Returns N */
+    static constexpr size_type capacity() noexcept { return N; }
+
+private:
+    alignas (T) unsigned char _storage[sizeof (T) * (N > 0 ? N : 1)];
+    size_type _size = 0;
+};
+
+} // namespace lvtk
@@ -3,11 +3,42 @@
 
 #pragma once
 
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <limits>
 #include <string>
+#include <type_traits>
 
 namespace lvtk {
+namespace detail {
+
+/** @private Size of a buffer big enough for any formatted number: the
+    309 integer digits of DBL_MAX in fixed notation, a sign, a point, six
+    decimals and the terminator.
+ */
+inline constexpr std::size_t number_chars = std::numeric_limits<double>::max_exponent10 + 1 + 1 + 1 + 6 + 1;
+
+/** @private Format an integer into `buf`, returns the length. */
+template <typename Int>
+inline std::size_t format_int (char* buf, Int value) noexcept {
+    return static_cast<std::size_t> (std::to_chars (buf, buf + number_chars, value).ptr - buf);
+}
+
+/** @private Format a float like std::to_string, returns the length. */
+inline std::size_t format_float (char* buf, double value) noexcept {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    return static_cast<std::size_t> (
+        std::to_chars (buf, buf + number_chars, value, std::chars_format::fixed, 6).ptr - buf);
+#else
+    const int n = std::snprintf (buf, number_chars, "%f", value);
+    return n > 0 ? static_cast<std::size_t> (n) : 0;
+#endif
+}
+
+} // namespace detail
 
 /** A typical String type.
     
@@ -59,25 +90,29 @@ public:
 
     /** Append an int */
     String& append (int i) {
-        _str.append (std::to_string (i));
+        char buf[detail::number_chars];
+        _str.append (buf, detail::format_int (buf, i));
         return *this;
     }
 
     /** Append an int64 */
     String& append (int64_t i) {
-        _str.append (std::to_string (i));
+        char buf[detail::number_chars];
+        _str.append (buf, detail::format_int (buf, i));
         return *this;
     }
 
     /** Append a float */
     String& append (float i) {
-        _str.append (std::to_string (i));
+        char buf[detail::number_chars];
+        _str.append (buf, detail::format_float (buf, i));
         return *this;
     }
 
     /** Append a double */
     String& append (double i) {
-        _str.append (std::to_string (i));
+        char buf[detail::number_chars];
+        _str.append (buf, detail::format_float (buf, i));
         return *this;
     }
 
@@ -136,4 +171,158 @@ APPEND (float)
 APPEND (double)
 #undef APPEND
 
+/** A string with inline storage for up to N characters.
+
+    Never allocates, so the text itself can be built inside run().
+    Appends which don't fit are cut off at the capacity and set the
+    truncated() flag.  Numbers are formatted the same as String.
+
+    Only building the text is realtime safe.  Hand the result on with
+    something that copies it, like an atom string written to a notify
+    port.  Don't pass c_str() to logger(), which calls the host, or to
+    rt_log(), which keeps `%s` arguments by pointer until the log is
+    flushed.
+
+    @code
+        lvtk::FixedString<64> msg;
+        msg << "gain: " << gain << " dB";
+        forge.write_string (msg.c_str()); // copied into the notify port
+    @endcode
+
+    @headerfile lvtk/string.hpp
+    @ingroup lvtk
+ */
+template <std::size_t N>
+class FixedString final {
+public:
+    static_assert (N > 0, "FixedString needs a capacity");
+
+    /** Create an empty string */
+    FixedString() noexcept { _buf[0] = '\0'; }
+    /** Create a string from a const char, truncated if needed */
+    FixedString (const char* str) noexcept : FixedString() { append (str); }
+    /** Create a string from a std::string, truncated if needed */
+    FixedString (const std::string& o) noexcept : FixedString() { append (o); }
+
+    FixedString (const FixedString& o) noexcept { *this = o; }
+    FixedString& operator= (const FixedString& o) noexcept {
+        if (this == &o)
+            return *this;
+        std::memcpy (_buf, o._buf, o._size + 1);
+        _size      = o._size;
+        _truncated = o._truncated;
+        return *this;
+    }
+    FixedString& operator= (const char* o) noexcept {
+        clear();
+        return append (o);
+    }
+
+    /** Clear this string and the truncated flag. */
+    void clear() noexcept {
+        _size      = 0;
+        _truncated = false;
+        _buf[0]    = '\0';
+    }
+
+    /** Append `len` chars of `str`. Stops at the capacity. */
+    FixedString& append (const char* str, std::size_t len) noexcept {
+        if (len > N - _size) {
+            len        = N - _size;
+            _truncated = true;
+        }
+        std::memcpy (_buf + _size, str, len);
+        _size += len;
+        _buf[_size] = '\0';
+        return *this;
+    }
+
+    /** Append a C string */
+    FixedString& append (const char* o) noexcept {
+        return o != nullptr ? append (o, std::strlen (o)) : *this;
+    }
+
+    /** Append a std::string */
+    FixedString& append (const std::string& o) noexcept { return append (o.data(), o.size()); }
+
+    /** Append a String */
+    FixedString& append (const String& o) noexcept { return append (o.str()); }
+
+    /** Append another FixedString */
+    template <std::size_t M>
+    FixedString& append (const FixedString<M>& o) noexcept {
+        return append (o.c_str(), o.size());
+    }
+
+    /** Append a single char */
+    FixedString& append (char c) noexcept { return append (&c, 1); }
+
+    /** Append an int */
+    FixedString& append (int i) noexcept { return append_int (i); }
+    /** Append an int64 */
+    FixedString& append (int64_t i) noexcept { return append_int (i); }
+    /** Append a uint32 */
+    FixedString& append (uint32_t i) noexcept { return append_int (i); }
+    /** Append a uint64 */
+    FixedString& append (uint64_t i) noexcept { return append_int (i); }
+    /** Append any other integer type, like size_t or long */
+    template <typename Int, std::enable_if_t<std::is_integral<Int>::value && ! std::is_same<Int, bool>::value, int> = 0>
+    FixedString& append (Int i) noexcept {
+        return append_int (i);
+    }
+
+    /** Append a float */
+    FixedString& append (float i) noexcept { return append_float (i); }
+    /** Append a double */
+    FixedString& append (double i) noexcept { return append_float (i); }
+
+    /** Returns the number of chars in this string */
+    std::size_t size() const noexcept { return _size; }
+    /** Returns true if this string is empty */
+    bool empty() const noexcept { return _size == 0; }
+    /** Returns the maximum number of chars */
+    static constexpr std::size_t capacity() noexcept { return N; }
+    /** Returns true if an append was cut off since the last clear() */
+    bool truncated() const noexcept { return _truncated; }
+
+    inline bool operator== (const char* o) const noexcept { return strcmp (_buf, o) == 0; }
+    inline bool operator!= (const char* o) const noexcept { return strcmp (_buf, o) != 0; }
+    template <std::size_t M>
+    inline bool operator== (const FixedString<M>& o) const noexcept {
+        return _size == o.size() && std::memcmp (_buf, o.c_str(), _size) == 0;
+    }
+    template <std::size_t M>
+    inline bool operator!= (const FixedString<M>& o) const noexcept {
+        return ! (*this == o);
+    }
+
+    /** Returns the C string of this FixedString */
+    const char* c_str() const noexcept { return _buf; }
+    operator const char*() const noexcept { return _buf; }
+    /** Returns a copy as std::string. Allocates. */
+    std::string str() const { return std::string (_buf, _size); }
+
+private:
+    char _buf[N + 1];
+    std::size_t _size = 0;
+    bool _truncated   = false;
+
+    template <typename Int>
+    FixedString& append_int (Int i) noexcept {
+        char buf[detail::number_chars];
+        return append (buf, detail::format_int (buf, i));
+    }
+
+    FixedString& append_float (double i) noexcept {
+        char buf[detail::number_chars];
+        return append (buf, detail::format_float (buf, i));
+    }
+};
+
+/** Append anything FixedString::append accepts */
+template <std::size_t N, typename T>
+inline FixedString<N>& operator<< (FixedString<N>& s, const T& val) noexcept {
+    return s.append (val);
+}
+
 } // namespace lvtk
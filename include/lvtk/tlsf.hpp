@@ -0,0 +1,405 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+
+#include <lvtk/arena.hpp>
+
+namespace lvtk {
+
+/** Usage counters of a TlsfResource.
+    @headerfile lvtk/tlsf.hpp
+    @ingroup lvtk
+ */
+struct TlsfStats final {
+    std::size_t capacity    = 0; ///< Largest possible allocation when empty
+    std::size_t used        = 0; ///< Bytes currently allocated, after rounding
+    std::size_t high_water  = 0; ///< Most bytes ever allocated at once
+    std::size_t allocations = 0; ///< Blocks currently allocated
+    std::size_t failures    = 0; ///< Requests that could not be served
+};
+
+/** A realtime safe memory resource.
+
+    Implements the Two-Level Segregated Fit allocator over one block of
+    memory reserved up front, usually in instantiate.  Allocating and
+    freeing take bounded time, independent of the number of blocks, and
+    never call into the system, so `std::pmr` containers can be used
+    from run().  Neighbouring free blocks are merged on free, which keeps
+    fragmentation low.
+
+    @code
+        // instantiate
+        pool = std::make_unique<lvtk::TlsfResource> (256 * 1024);
+        voices = std::pmr::vector<Voice> (pool.get());
+        voices.reserve (16);
+
+        // run
+        auto event = pool->try_allocate (atom_total_size (atom), alignof (LV2_Atom));
+        if (event == nullptr)
+            return; // drop it, the pool is full
+    @endcode
+
+    A full pool throws std::bad_alloc from allocate(), as required of any
+    memory_resource.  Use try_allocate() to get nullptr instead.
+
+    Not thread safe: allocate and free on one thread at a time.
+    statistics() may be read from any thread.
+
+    @headerfile lvtk/tlsf.hpp
+    @ingroup lvtk
+ */
+class TlsfResource final : public std::pmr::memory_resource {
+public:
+    /** Manage `size` bytes at `buffer`, which must outlive the resource */
+    TlsfResource (void* buffer, std::size_t size) noexcept {
+        init (buffer, size);
+    }
+
+    /** Allocate and pre-fault `size` bytes to manage.  Not realtime safe. */
+    explicit TlsfResource (std::size_t size)
+        : _owned (::operator new (size, std::align_val_t (alignment))) {
+        std::memset (_owned, 0, size);
+        init (_owned, size);
+    }
+
+    /** Manage `size` bytes taken from `arena`.  If the arena can't provide
+        them the resource is empty and every allocation fails.
+     */
+    TlsfResource (Arena& arena, std::size_t size) noexcept {
+        init (arena.allocate (size), size);
+    }
+
+    ~TlsfResource() override {
+        if (_owned != nullptr)
+            ::operator delete (_owned, std::align_val_t (alignment));
+    }
+
+    TlsfResource (const TlsfResource&)            = delete;
+    TlsfResource& operator= (const TlsfResource&) = delete;
+
+    /** Returns `bytes` aligned to `align` (a power of two), or nullptr if
+        there is no free block large enough.
+     */
+    void* try_allocate (std::size_t bytes, std::size_t align = alignof (std::max_align_t)) noexcept {
+        if (bytes > max_block || align > max_block) {
+            fail();
+            return nullptr;
+        }
+
+        const std::size_t size = adjust (bytes);
+        const std::size_t gap  = align > alignment ? align + min_block : 0;
+        Block* block           = take_free (size + gap);
+        if (block == nullptr) {
+            fail();
+            return nullptr;
+        }
+
+        if (gap != 0) {
+            // split off the front so the payload lands on the boundary
+            auto payload          = reinterpret_cast<uintptr_t> (block->payload());
+            const auto aligned    = round_up (payload, align);
+            const std::size_t pad = aligned == payload ? 0 : round_up (payload + min_block, align) - payload;
+            if (pad != 0) {
+                Block* next = split (block, pad - header);
+                insert (block);
+                block = next;
+            }
+        }
+
+        if (block->size() >= size + min_block)
+            insert (split (block, size));
+
+        block->set_used();
+        count_alloc (block->size());
+        return block->payload();
+    }
+
+    /** Returns a snapshot of the usage counters */
+    TlsfStats statistics() const noexcept {
+        TlsfStats stats;
+        stats.capacity    = _capacity;
+        stats.used        = _used.load (std::memory_order_relaxed);
+        stats.high_water  = _high_water.load (std::memory_order_relaxed);
+        stats.allocations = _allocations.load (std::memory_order_relaxed);
+        stats.failures    = _failures.load (std::memory_order_relaxed);
+        return stats;
+    }
+
+    /** Restart the high water mark at the current usage */
+    void reset_high_water() noexcept {
+        _high_water.store (_used.load (std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    /** Returns true if `ptr` points into the managed memory */
+    bool owns (const void* ptr) const noexcept {
+        const auto p = static_cast<const uint8_t*> (ptr);
+        return p >= _begin && p < _end;
+    }
+
+private:
+    static constexpr std::size_t alignment = 16;
+    static constexpr unsigned align_log2   = 4;
+    static constexpr unsigned sl_log2      = 5; // 32 second level lists
+    static constexpr unsigned sl_count     = 1u << sl_log2;
+    static constexpr unsigned fl_shift     = sl_log2 + align_log2;
+    static constexpr unsigned fl_max       = sizeof (std::size_t) >= 8 ? 40 : 30; // up to 1 TiB
+    static constexpr unsigned fl_count     = fl_max - fl_shift + 1;
+    static constexpr std::size_t small     = std::size_t (1) << fl_shift;
+    static constexpr std::size_t max_block = (std::size_t (1) << fl_max) - 1;
+
+    /** Physical block header.  The free list links overlay the payload,
+        they only exist while the block is free.
+     */
+    struct Block {
+        Block* prev_phys;
+        std::size_t bits; // payload size | free flag
+        Block* next_free;
+        Block* prev_free;
+
+        std::size_t size() const noexcept { return bits & ~std::size_t (1); }
+        void set_size (std::size_t s) noexcept { bits = s | (bits & 1); }
+        bool free() const noexcept { return (bits & 1) != 0; }
+        void set_free() noexcept { bits |= 1; }
+        void set_used() noexcept { bits &= ~std::size_t (1); }
+        void* payload() noexcept { return reinterpret_cast<uint8_t*> (this) + header; }
+        Block* next() noexcept { return reinterpret_cast<Block*> (reinterpret_cast<uint8_t*> (payload()) + size()); }
+    };
+
+    static constexpr std::size_t header    = offsetof (Block, next_free);
+    static constexpr std::size_t min_block = sizeof (Block);
+
+    uint32_t _fl_bitmap = 0;
+    uint32_t _sl_bitmap[fl_count] {};
+    Block* _lists[fl_count][sl_count] {};
+
+    uint8_t* _begin       = nullptr;
+    uint8_t* _end         = nullptr;
+    std::size_t _capacity = 0;
+    void* _owned          = nullptr;
+
+    std::atomic<std::size_t> _used { 0 };
+    std::atomic<std::size_t> _high_water { 0 };
+    std::atomic<std::size_t> _allocations { 0 };
+    std::atomic<std::size_t> _failures { 0 };
+
+    void* do_allocate (std::size_t bytes, std::size_t align) override {
+        void* ptr = try_allocate (bytes, align);
+        if (ptr == nullptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    void do_deallocate (void* ptr, std::size_t, std::size_t) override {
+        if (ptr == nullptr)
+            return;
+        auto block = reinterpret_cast<Block*> (static_cast<uint8_t*> (ptr) - header);
+        count_free (block->size());
+        block->set_free();
+        block = merge_prev (block);
+        block = merge_next (block);
+        insert (block);
+    }
+
+    bool do_is_equal (const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    void init (void* buffer, std::size_t size) noexcept {
+        if (buffer == nullptr)
+            return;
+        const auto start = round_up (reinterpret_cast<uintptr_t> (buffer), alignment);
+        const auto stop  = (reinterpret_cast<uintptr_t> (buffer) + size) & ~(alignment - 1);
+        if (stop <= start || stop - start < header + min_block + header)
+            return;
+
+        std::size_t payload = stop - start - 2 * header;
+        if (payload > max_block)
+            payload = max_block & ~(alignment - 1);
+
+        auto first       = reinterpret_cast<Block*> (start);
+        first->prev_phys = nullptr;
+        first->bits      = payload;
+        first->set_free();
+
+        // zero sized, never free sentinel, stops merging past the end
+        auto last       = first->next();
+        last->prev_phys = first;
+        last->bits      = 0;
+
+        _begin    = reinterpret_cast<uint8_t*> (first);
+        _end      = reinterpret_cast<uint8_t*> (last);
+        _capacity = payload;
+        insert (first);
+    }
+
+    static constexpr std::size_t round_up (std::size_t value, std::size_t align) noexcept {
+        return (value + align - 1) & ~(align - 1);
+    }
+
+    static std::size_t adjust (std::size_t bytes) noexcept {
+        const auto size = round_up (bytes, alignment);
+        return size < min_block - header ? min_block - header : size;
+    }
+
+    static unsigned msb (std::size_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return (unsigned) (sizeof (unsigned long long) * 8 - 1) - (unsigned) __builtin_clzll (value);
+#else
+        unsigned bit = 0;
+        while (value >>= 1)
+            ++bit;
+        return bit;
+#endif
+    }
+
+    static unsigned lsb (uint32_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return (unsigned) __builtin_ctz (value);
+#else
+        unsigned bit = 0;
+        while ((value & 1u) == 0) {
+            value >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    static void mapping (std::size_t size, unsigned& fl, unsigned& sl) noexcept {
+        if (size < small) {
+            fl = 0;
+            sl = (unsigned) (size / (small / sl_count));
+        } else {
+            const unsigned bit = msb (size);
+            sl                 = (unsigned) (size >> (bit - sl_log2)) ^ sl_count;
+            fl                 = bit - fl_shift + 1;
+        }
+    }
+
+    void insert (Block* block) noexcept {
+        unsigned fl, sl;
+        mapping (block->size(), fl, sl);
+        Block* head      = _lists[fl][sl];
+        block->next_free = head;
+        block->prev_free = nullptr;
+        if (head != nullptr)
+            head->prev_free = block;
+        _lists[fl][sl] = block;
+        _fl_bitmap |= 1u << fl;
+        _sl_bitmap[fl] |= 1u << sl;
+        block->set_free();
+        block->next()->prev_phys = block;
+    }
+
+    void remove (Block* block) noexcept {
+        unsigned fl, sl;
+        mapping (block->size(), fl, sl);
+        if (block->prev_free != nullptr)
+            block->prev_free->next_free = block->next_free;
+        else
+            _lists[fl][sl] = block->next_free;
+        if (block->next_free != nullptr)
+            block->next_free->prev_free = block->prev_free;
+
+        if (_lists[fl][sl] == nullptr) {
+            _sl_bitmap[fl] &= ~(1u << sl);
+            if (_sl_bitmap[fl] == 0)
+                _fl_bitmap &= ~(1u << fl);
+        }
+    }
+
+    /** Finds, unlinks and returns a free block of at least `size` */
+    Block* take_free (std::size_t size) noexcept {
+        if (size > max_block)
+            return nullptr;
+
+        unsigned fl, sl;
+        // round up to the next list, any block in there fits
+        const std::size_t search = size >= small ? size + (std::size_t (1) << (msb (size) - sl_log2)) - 1 : size;
+        mapping (search, fl, sl);
+
+        uint32_t sl_map = fl < fl_count ? _sl_bitmap[fl] & (~0u << sl) : 0;
+        if (sl_map == 0) {
+            const uint32_t fl_map = fl + 1 < fl_count ? _fl_bitmap & (~0u << (fl + 1)) : 0;
+            if (fl_map != 0) {
+                fl     = lsb (fl_map);
+                sl_map = _sl_bitmap[fl];
+            }
+        }
+
+        Block* block = nullptr;
+        if (sl_map != 0) {
+            block = _lists[fl][lsb (sl_map)];
+        } else {
+            // only the list holding `size` itself is left, try its head
+            mapping (size, fl, sl);
+            block = _lists[fl][sl];
+            if (block == nullptr || block->size() < size)
+                return nullptr;
+        }
+
+        remove (block);
+        return block;
+    }
+
+    /** Shrinks `block` to `size` and returns the remainder as a new block */
+    Block* split (Block* block, std::size_t size) noexcept {
+        const std::size_t rest = block->size() - size - header;
+        block->set_size (size);
+        Block* next     = block->next();
+        next->prev_phys = block;
+        next->bits      = rest;
+        next->next()->prev_phys = next;
+        return next;
+    }
+
+    Block* merge_prev (Block* block) noexcept {
+        Block* prev = block->prev_phys;
+        if (prev == nullptr || ! prev->free())
+            return block;
+        remove (prev);
+        prev->set_size (prev->size() + header + block->size());
+        prev->next()->prev_phys = prev;
+        return prev;
+    }
+
+    Block* merge_next (Block* block) noexcept {
+        Block* next = block->next();
+        if (! next->free())
+            return block;
+        remove (next);
+        block->set_size (block->size() + header + next->size());
+        block->next()->prev_phys = block;
+        return block;
+    }
+
+    // single writer, no need for locked adds
+    static void add (std::atomic<std::size_t>& counter, std::size_t value) noexcept {
+        counter.store (counter.load (std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    void count_alloc (std::size_t size) noexcept {
+        add (_used, size);
+        add (_allocations, 1);
+        const auto used = _used.load (std::memory_order_relaxed);
+        if (used > _high_water.load (std::memory_order_relaxed))
+            _high_water.store (used, std::memory_order_relaxed);
+    }
+
+    void count_free (std::size_t size) noexcept {
+        _used.store (_used.load (std::memory_order_relaxed) - size, std::memory_order_relaxed);
+        _allocations.store (_allocations.load (std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    }
+
+    void fail() noexcept { add (_failures, 1); }
+};
+
+} // namespace lvtk
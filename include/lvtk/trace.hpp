@@ -0,0 +1,267 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/** @defgroup trace Tracing
+    Timestamps of plugin and UI callbacks for latency investigations.
+
+    Build your plugin with `-DLVTK_TRACE=1` and every callback lvtk routes
+    to your code (instantiate, activate, connect_port, run, deactivate,
+    cleanup, the Worker, State and UI port_event and idle) is timed.
+    Without it the hooks compile to nothing.
+
+    Each callback is recorded in the in-process lvtk::trace::Recorder,
+    which can be written as Chrome trace JSON for chrome://tracing or
+    https://ui.perfetto.dev.  Set the `LVTK_TRACE_FILE` environment
+    variable to write it when the plugin is unloaded.
+
+    Where `<sys/sdt.h>` is available the hooks also fire USDT probes,
+    which cost a single nop until a tracer attaches:
+    `lvtk:<callback>` on entry with one argument (frames for run, the
+    port for connect_port and port_event, the size for work) and
+    `lvtk:scope_exit` on return with the callback name and duration in
+    nanoseconds.  Define `LVTK_TRACE_NO_USDT` to leave them out.
+
+    @code
+        $ bpftrace -e 'usdt:./volume.so:lvtk:run { @frames = hist(arg0); }'
+    @endcode
+ */
+
+#ifndef LVTK_TRACE
+/** Define to 1 to enable the tracing hooks
+    @ingroup trace
+ */
+#    define LVTK_TRACE 0
+#endif
+
+#if LVTK_TRACE && ! defined(LVTK_TRACE_NO_USDT) && defined(__has_include)
+#    if __has_include(<sys/sdt.h>)
+#        include <sys/sdt.h>
+#        define LVTK_TRACE_USDT 1
+#    endif
+#endif
+
+#ifndef LVTK_TRACE_USDT
+#    define LVTK_TRACE_USDT 0
+#endif
+
+namespace lvtk {
+namespace trace {
+
+/** A finished, recorded scope
+    @ingroup trace
+    @headerfile lvtk/trace.hpp
+ */
+struct Event final {
+    const char* name = nullptr; ///< Static name of the scope
+    uint64_t start   = 0;       ///< Start time in nanoseconds
+    uint64_t duration = 0;      ///< Duration in nanoseconds
+    uint64_t value   = 0;       ///< Argument, e.g. frames for run
+    uint32_t thread  = 0;       ///< Small integer id of the thread
+};
+
+/** Returns a monotonic timestamp in nanoseconds
+    @ingroup trace
+ */
+inline uint64_t now() noexcept {
+    using namespace std::chrono;
+    return (uint64_t) duration_cast<nanoseconds> (steady_clock::now().time_since_epoch()).count();
+}
+
+/** Returns a small id for the calling thread, numbered in order of first use
+    @ingroup trace
+ */
+inline uint32_t thread_id() noexcept {
+    static std::atomic<uint32_t> s_next { 1 };
+    static thread_local const uint32_t s_id = s_next.fetch_add (1, std::memory_order_relaxed);
+    return s_id;
+}
+
+/** Keeps the most recent trace events in a ring.
+
+    Recording is wait-free from any number of threads and never
+    allocates.  When full the oldest events are overwritten.
+
+    @ingroup trace
+    @headerfile lvtk/trace.hpp
+ */
+class Recorder final {
+public:
+    /** Number of events kept */
+    static constexpr uint32_t capacity = 8192;
+
+    /** Returns the recorder used by the tracing hooks */
+    static Recorder& instance() noexcept {
+        static Recorder s_recorder;
+        return s_recorder;
+    }
+
+    ~Recorder() {
+        if (const char* path = std::getenv ("LVTK_TRACE_FILE"))
+            write_chrome_json (path);
+    }
+
+    /** Record a finished scope */
+    void record (const char* name, uint64_t start, uint64_t duration, uint64_t value) noexcept {
+        if (! _enabled.load (std::memory_order_relaxed))
+            return;
+        const uint64_t index = _next.fetch_add (1, std::memory_order_relaxed);
+        Slot& slot           = _slots[index % capacity];
+        slot.seq.store (0, std::memory_order_relaxed);
+        std::atomic_thread_fence (std::memory_order_release);
+        slot.name.store (name, std::memory_order_relaxed);
+        slot.start.store (start, std::memory_order_relaxed);
+        slot.duration.store (duration, std::memory_order_relaxed);
+        slot.value.store (value, std::memory_order_relaxed);
+        slot.thread.store (thread_id(), std::memory_order_relaxed);
+        slot.seq.store (index + 1, std::memory_order_release);
+    }
+
+    /** Pause or resume recording.  Enabled by default. */
+    void set_enabled (bool enabled) noexcept { _enabled.store (enabled, std::memory_order_relaxed); }
+
+    /** Returns true if recording */
+    bool enabled() const noexcept { return _enabled.load (std::memory_order_relaxed); }
+
+    /** Forget all events */
+    void clear() noexcept {
+        for (auto& slot : _slots)
+            slot.seq.store (0, std::memory_order_relaxed);
+    }
+
+    /** Returns the recorded events, oldest first.  Events being written
+        while copying are skipped.
+     */
+    std::vector<Event> events() const {
+        std::vector<Event> result;
+        const uint64_t last  = _next.load (std::memory_order_acquire);
+        const uint64_t first = last > capacity ? last - capacity : 0;
+        result.reserve ((std::size_t) (last - first));
+
+        for (uint64_t i = first; i < last; ++i) {
+            const Slot& slot = _slots[i % capacity];
+            if (slot.seq.load (std::memory_order_acquire) != i + 1)
+                continue;
+            Event ev;
+            ev.name     = slot.name.load (std::memory_order_relaxed);
+            ev.start    = slot.start.load (std::memory_order_relaxed);
+            ev.duration = slot.duration.load (std::memory_order_relaxed);
+            ev.value    = slot.value.load (std::memory_order_relaxed);
+            ev.thread   = slot.thread.load (std::memory_order_relaxed);
+            std::atomic_thread_fence (std::memory_order_acquire);
+            if (slot.seq.load (std::memory_order_relaxed) == i + 1)
+                result.push_back (ev);
+        }
+        return result;
+    }
+
+    /** Returns the recorded events in Chrome trace event format */
+    std::string chrome_json() const {
+        std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        const auto evs   = events();
+        const uint64_t origin = evs.empty() ? 0 : evs.front().start;
+        char line[256];
+        bool first = true;
+        for (const auto& ev : evs) {
+            // microseconds, with nanosecond fraction
+            const uint64_t ts = ev.start > origin ? ev.start - origin : 0;
+            std::snprintf (line, sizeof (line),
+                           "%s{\"name\":\"%s\",\"cat\":\"lvtk\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                           "\"ts\":%llu.%03u,\"dur\":%llu.%03u,\"args\":{\"value\":%llu}}",
+                           first ? "" : ",\n",
+                           ev.name != nullptr ? ev.name : "?",
+                           ev.thread,
+                           (unsigned long long) (ts / 1000),
+                           (unsigned) (ts % 1000),
+                           (unsigned long long) (ev.duration / 1000),
+                           (unsigned) (ev.duration % 1000),
+                           (unsigned long long) ev.value);
+            json += line;
+            first = false;
+        }
+        json += "]}\n";
+        return json;
+    }
+
+    /** Write chrome_json() to a file.  Returns false on error. */
+    bool write_chrome_json (const char* path) const {
+        FILE* file = std::fopen (path, "w");
+        if (file == nullptr)
+            return false;
+        const auto json = chrome_json();
+        const bool ok   = std::fwrite (json.data(), 1, json.size(), file) == json.size();
+        return std::fclose (file) == 0 && ok;
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> seq { 0 };
+        std::atomic<const char*> name { nullptr };
+        std::atomic<uint64_t> start { 0 };
+        std::atomic<uint64_t> duration { 0 };
+        std::atomic<uint64_t> value { 0 };
+        std::atomic<uint32_t> thread { 0 };
+    };
+
+    Recorder() = default;
+
+    std::atomic<uint64_t> _next { 0 };
+    std::atomic<bool> _enabled { true };
+    Slot _slots[capacity];
+};
+
+/** Records the time spent in a C++ scope.
+    Prefer LVTK_TRACE_SCOPE, which disappears when tracing is disabled.
+    @ingroup trace
+    @headerfile lvtk/trace.hpp
+ */
+class Scope final {
+public:
+    explicit Scope (const char* name, uint64_t value = 0) noexcept
+        : _name (name), _value (value), _start (now()) {}
+
+    ~Scope() {
+        const uint64_t duration = now() - _start;
+#if LVTK_TRACE_USDT
+        DTRACE_PROBE2 (lvtk, scope_exit, _name, duration);
+#endif
+        Recorder::instance().record (_name, _start, duration, _value);
+    }
+
+    Scope (const Scope&)            = delete;
+    Scope& operator= (const Scope&) = delete;
+
+private:
+    const char* _name;
+    uint64_t _value;
+    uint64_t _start;
+};
+
+} // namespace trace
+} // namespace lvtk
+
+#if LVTK_TRACE
+#    if LVTK_TRACE_USDT
+#        define LVTK_TRACE_PROBE(name, value) DTRACE_PROBE1 (lvtk, name, (uint64_t) (value))
+#    else
+#        define LVTK_TRACE_PROBE(name, value) ((void) 0)
+#    endif
+/** Trace the rest of the enclosing scope as `name`, an identifier.
+    `value` is only evaluated when tracing is enabled.
+    @ingroup trace
+ */
+#    define LVTK_TRACE_SCOPE(name, value) \
+        LVTK_TRACE_PROBE (name, value);   \
+        const ::lvtk::trace::Scope lvtk_trace_scope_ (#name, (uint64_t) (value))
+#else
+#    define LVTK_TRACE_SCOPE(name, value) ((void) 0)
+#endif
@@ -0,0 +1,310 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <lvtk/static_vector.hpp>
+
+#include <lv2/atom/atom.h>
+#include <lv2/atom/util.h>
+#include <lv2/time/time.h>
+#include <lv2/urid/urid.h>
+
+namespace lvtk {
+
+/** Host transport position, as sent in time:Position objects
+    @headerfile lvtk/transport.hpp
+ */
+struct TransportState {
+    double speed         = 0.0;   ///< time:speed, 0 stopped, 1 playing
+    double bpm           = 120.0; ///< time:beatsPerMinute
+    double beat          = 0.0;   ///< time:beat, beats since the start
+    double bar_beat      = 0.0;   ///< time:barBeat, beat within the bar
+    int64_t bar          = 0;     ///< time:bar
+    double beats_per_bar = 4.0;   ///< time:beatsPerBar
+    int32_t beat_unit    = 4;     ///< time:beatUnit
+    int64_t frame        = 0;     ///< time:frame
+
+    /** Returns true if the transport is moving */
+    bool rolling() const noexcept { return speed != 0.0; }
+
+    /** Returns beats advanced per frame at `sample_rate` */
+    double beats_per_frame (double sample_rate) const noexcept {
+        return speed * bpm / (60.0 * sample_rate);
+    }
+};
+
+/** Tracks the host transport from time:Position events.
+
+    Call process() once per block with the plugin's atom input.  Position
+    objects are decoded in one pass over their properties with URIDs mapped
+    up front, and between updates the position is advanced by the tempo
+    and speed, so it stays valid in blocks the host sends nothing.  A block
+    with updates in the middle is split into segments, and every query
+    below is exact to the frame.
+
+    @code
+        // run()
+        transport.process (events, nframes);
+        transport.for_each_beat (1.0, nframes, [&] (uint32_t frame, double beat) {
+            click.trigger (frame, beat);
+        });
+    @endcode
+
+    Realtime safe after construction.
+
+    @tparam MaxSegments  Segments kept per block, at least 2: the start of
+                         the block and one per update.  When full, each
+                         further update replaces the last one.
+    @headerfile lvtk/transport.hpp
+ */
+template <uint32_t MaxSegments = 8>
+class BasicTransport final {
+    static_assert (MaxSegments >= 2, "BasicTransport needs room for an update after the block start");
+
+public:
+    /** Maps the time and atom URIDs.  Not realtime safe. */
+    explicit BasicTransport (LV2_URID_Map* map, double sample_rate = 44100.0)
+        : _sample_rate (sample_rate) {
+        auto m            = [map] (const char* uri) { return map->map (map->handle, uri); };
+        _position         = m (LV2_TIME__Position);
+        _bar              = m (LV2_TIME__bar);
+        _bar_beat         = m (LV2_TIME__barBeat);
+        _beat             = m (LV2_TIME__beat);
+        _beat_unit        = m (LV2_TIME__beatUnit);
+        _beats_per_bar    = m (LV2_TIME__beatsPerBar);
+        _beats_per_minute = m (LV2_TIME__beatsPerMinute);
+        _frame            = m (LV2_TIME__frame);
+        _speed            = m (LV2_TIME__speed);
+        _atom_object      = m (LV2_ATOM__Object);
+        _atom_blank       = m (LV2_ATOM__Blank);
+        _atom_resource    = m (LV2_ATOM__Resource);
+        _atom_float       = m (LV2_ATOM__Float);
+        _atom_double      = m (LV2_ATOM__Double);
+        _atom_int         = m (LV2_ATOM__Int);
+        _atom_long        = m (LV2_ATOM__Long);
+        _segments.push_back ({ 0, TransportState() });
+    }
+
+    /** Set the sample rate used to advance the position */
+    void set_sample_rate (double sample_rate) noexcept { _sample_rate = sample_rate; }
+
+    /** Returns the sample rate */
+    double sample_rate() const noexcept { return _sample_rate; }
+
+    /** Advance to the next block and read its position updates.
+
+        @param seq      Atom input with frame timestamps, may be null
+        @param nframes  Frames in this block
+        @returns The number of time:Position objects read
+     */
+    uint32_t process (const LV2_Atom_Sequence* seq, uint32_t nframes) noexcept {
+        const auto& last     = _segments.back();
+        TransportState state = advanced (last.state, _nframes - last.offset);
+        _segments.clear();
+        _segments.push_back ({ 0, state });
+        _nframes = nframes;
+        _updates = 0;
+
+        if (seq == nullptr)
+            return 0;
+
+        LV2_ATOM_SEQUENCE_FOREACH (seq, ev) {
+            const auto obj = reinterpret_cast<const LV2_Atom_Object*> (&ev->body);
+            if ((ev->body.type != _atom_object && ev->body.type != _atom_blank && ev->body.type != _atom_resource)
+                || obj->body.otype != _position)
+                continue;
+
+            const int64_t t       = ev->time.frames;
+            const uint32_t offset = t <= 0 ? 0 : (t >= (int64_t) nframes ? (nframes > 0 ? nframes - 1 : 0) : (uint32_t) t);
+            auto& seg             = _segments.back();
+            TransportState next   = advanced (seg.state, offset - seg.offset);
+            decode (obj, next);
+            if (offset == seg.offset) {
+                seg.state = next;
+            } else if (_segments.full()) {
+                // drop the last update, the one before runs up to this one
+                seg.offset = offset;
+                seg.state  = next;
+            } else {
+                _segments.push_back ({ offset, next });
+            }
+            ++_updates;
+        }
+
+        return _updates;
+    }
+
+    /** Returns the position at the start of the block */
+    const TransportState& state() const noexcept { return _segments[0].state; }
+
+    /** Returns the position at a frame in the block */
+    TransportState state_at (uint32_t offset) const noexcept {
+        const auto& seg = segment (offset);
+        return advanced (seg.state, offset - seg.offset);
+    }
+
+    /** Returns the beat at a frame in the block */
+    double beat_at (uint32_t offset) const noexcept {
+        const auto& seg = segment (offset);
+        return seg.state.beat + (offset - seg.offset) * seg.state.beats_per_frame (_sample_rate);
+    }
+
+    /** Returns true if the host sent a position in this block */
+    bool changed() const noexcept { return _updates > 0; }
+
+    /** Write the beat of every frame in the block to `dst` */
+    void beats (double* dst, uint32_t nframes) const noexcept {
+        for_each_segment (nframes, [dst] (uint32_t offset, uint32_t n, double beat, double step) {
+            double* out = dst + offset;
+            for (uint32_t i = 0; i < n; ++i)
+                out[i] = beat + step * (double) i;
+        });
+    }
+
+    /** Call `fn (frame, beat)` for every multiple of `division` beats the
+        transport crosses in the block, e.g. 1.0 for every beat or 0.25 for
+        sixteenths.  Nothing is called while stopped.
+     */
+    template <class Fn>
+    void for_each_beat (double division, uint32_t nframes, Fn&& fn) const {
+        if (division <= 0.0)
+            return;
+        for_each_segment (nframes, [&] (uint32_t offset, uint32_t n, double beat, double step) {
+            if (step <= 0.0)
+                return;
+            const double end = beat + step * (double) n;
+            for (double next = std::ceil (beat / division) * division; next < end; next += division) {
+                const uint32_t frame = (uint32_t) std::ceil ((next - beat) / step - 1.0e-9);
+                if (frame < n)
+                    fn (offset + frame, next);
+            }
+        });
+    }
+
+    /** Call `fn (offset, nframes, beat, beats_per_frame)` for each run of
+        frames with a constant tempo and speed.
+     */
+    template <class Fn>
+    void for_each_segment (uint32_t nframes, Fn&& fn) const {
+        for (uint32_t i = 0; i < _segments.size(); ++i) {
+            const auto& seg   = _segments[i];
+            const uint32_t to = i + 1 < _segments.size() ? _segments[i + 1].offset : nframes;
+            if (to > seg.offset)
+                fn (seg.offset, to - seg.offset, seg.state.beat, seg.state.beats_per_frame (_sample_rate));
+        }
+    }
+
+private:
+    struct Segment {
+        uint32_t offset;
+        TransportState state;
+    };
+
+    StaticVector<Segment, MaxSegments> _segments;
+    double _sample_rate;
+    uint32_t _nframes = 0;
+    uint32_t _updates = 0;
+
+    LV2_URID _position = 0, _bar = 0, _bar_beat = 0, _beat = 0, _beat_unit = 0,
+             _beats_per_bar = 0, _beats_per_minute = 0, _frame = 0, _speed = 0;
+    LV2_URID _atom_object = 0, _atom_blank = 0, _atom_resource = 0,
+             _atom_float = 0, _atom_double = 0, _atom_int = 0, _atom_long = 0;
+
+    const Segment& segment (uint32_t offset) const noexcept {
+        uint32_t i = _segments.size() - 1;
+        while (i > 0 && _segments[i].offset > offset)
+            --i;
+        return _segments[i];
+    }
+
+    TransportState advanced (const TransportState& s, uint32_t nframes) const noexcept {
+        if (nframes == 0 || s.speed == 0.0)
+            return s;
+        TransportState next = s;
+        const double beats  = nframes * s.beats_per_frame (_sample_rate);
+        next.beat += beats;
+        next.bar_beat += beats;
+        if (next.beats_per_bar > 0.0 && next.bar_beat >= next.beats_per_bar) {
+            const double bars = std::floor (next.bar_beat / next.beats_per_bar);
+            next.bar += (int64_t) bars;
+            next.bar_beat -= bars * next.beats_per_bar;
+        }
+        next.frame += (int64_t) std::llround (s.speed * nframes);
+        return next;
+    }
+
+    bool number (const LV2_Atom& atom, double& value) const noexcept {
+        const void* body = &atom + 1;
+        if (atom.type == _atom_float && atom.size >= sizeof (float)) {
+            float f;
+            std::memcpy (&f, body, sizeof (float));
+            value = f;
+        } else if (atom.type == _atom_double && atom.size >= sizeof (double)) {
+            std::memcpy (&value, body, sizeof (double));
+        } else if (atom.type == _atom_long && atom.size >= sizeof (int64_t)) {
+            int64_t l;
+            std::memcpy (&l, body, sizeof (int64_t));
+            value = (double) l;
+        } else if (atom.type == _atom_int && atom.size >= sizeof (int32_t)) {
+            int32_t i;
+            std::memcpy (&i, body, sizeof (int32_t));
+            value = i;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    /** Single pass over a time:Position, updating only what it has. */
+    void decode (const LV2_Atom_Object* obj, TransportState& s) noexcept {
+        bool has_beat = false, has_bar_beat = false, has_bar = false;
+        LV2_ATOM_OBJECT_FOREACH (obj, prop) {
+            double v = 0.0;
+            if (! number (prop->value, v))
+                continue;
+            const LV2_URID key = prop->key;
+            if (key == _speed) {
+                s.speed = v;
+            } else if (key == _beats_per_minute) {
+                s.bpm = v;
+            } else if (key == _beat) {
+                s.beat   = v;
+                has_beat = true;
+            } else if (key == _bar_beat) {
+                s.bar_beat   = v;
+                has_bar_beat = true;
+            } else if (key == _bar) {
+                s.bar   = (int64_t) v;
+                has_bar = true;
+            } else if (key == _beats_per_bar) {
+                s.beats_per_bar = v;
+            } else if (key == _beat_unit) {
+                s.beat_unit = (int32_t) v;
+            } else if (key == _frame) {
+                s.frame = (int64_t) v;
+            }
+        }
+
+        // fill in whichever of beat or bar + barBeat the host left out
+        if (! has_beat && (has_bar || has_bar_beat)) {
+            s.beat = (double) s.bar * s.beats_per_bar + s.bar_beat;
+        } else if (has_beat && ! has_bar_beat && s.beats_per_bar > 0.0) {
+            const double bars = std::floor (s.beat / s.beats_per_bar);
+            s.bar_beat        = s.beat - bars * s.beats_per_bar;
+            if (! has_bar)
+                s.bar = (int64_t) bars;
+        }
+    }
+};
+
+/** Transport with the default number of segments per block
+    @headerfile lvtk/transport.hpp
+ */
+using Transport = BasicTransport<>;
+
+} // namespace lvtk
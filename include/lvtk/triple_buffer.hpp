@@ -0,0 +1,97 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace lvtk {
+
+/** Wait-free single writer, single reader exchange of the latest value.
+
+    Three copies of T are kept.  The writer fills one and publishes it,
+    the reader picks up the most recently published one.  Neither side
+    ever waits for, or sees a half written value from, the other.  Values
+    published faster than they are read are skipped, which is what a meter
+    or scope display wants.
+
+    @code
+        // audio thread
+        auto& m = meters.write_buffer();
+        m.peak  = peak;
+        meters.publish();
+
+        // UI thread
+        if (meters.update())
+            draw (meters.read_buffer());
+    @endcode
+
+    @tparam T value type
+    @headerfile lvtk/triple_buffer.hpp
+    @ingroup utility
+ */
+template <typename T>
+class TripleBuffer final {
+public:
+    /** Value initializes all three copies */
+    TripleBuffer() = default;
+
+    /** Initializes all three copies to `value` */
+    explicit TripleBuffer (const T& value) {
+        for (auto& s : _slots)
+            s.value = value;
+    }
+
+    TripleBuffer (const TripleBuffer&)            = delete;
+    TripleBuffer& operator= (const TripleBuffer&) = delete;
+
+    /** Writer: the copy to fill.  Holds whatever was written into it last
+        time it was current, not necessarily the last published value.
+     */
+    T& write_buffer() noexcept { return _slots[_write].value; }
+
+    /** Writer: make write_buffer() the latest value and get a new one */
+    void publish() noexcept {
+        _write = _middle.exchange (_write | dirty, std::memory_order_acq_rel) & index;
+    }
+
+    /** Writer: copy `value` in and publish it */
+    void write (const T& value) noexcept {
+        write_buffer() = value;
+        publish();
+    }
+
+    /** Reader: take the latest published value, if there is a new one.
+        @returns true if read_buffer() changed
+     */
+    bool update() noexcept {
+        if ((_middle.load (std::memory_order_relaxed) & dirty) == 0)
+            return false;
+        _read = _middle.exchange (_read, std::memory_order_acq_rel) & index;
+        return true;
+    }
+
+    /** Reader: the value taken by the last update() */
+    const T& read_buffer() const noexcept { return _slots[_read].value; }
+
+    /** Reader: update() and return the latest value */
+    const T& read() noexcept {
+        update();
+        return read_buffer();
+    }
+
+private:
+    enum : uint8_t { index = 0x03, dirty = 0x04 };
+
+    struct alignas (64) Slot {
+        T value {};
+    };
+
+    Slot _slots[3];
+    alignas (64) std::atomic<uint8_t> _middle { 1 };
+    alignas (64) uint8_t _write = 0;
+    alignas (64) uint8_t _read  = 2;
+};
+
+} // namespace lvtk
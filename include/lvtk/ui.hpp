@@ -18,14 +18,22 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <lv2/core/lv2.h>
 #include <lv2/ui/ui.h>
 #include <lvtk/lvtk.hpp>
+#include <lvtk/trace.hpp>
 
 namespace lvtk {
+
+template <class I>
+struct BatchWrites; // lvtk/ext/batch_writes.hpp
+template <class I>
+struct CoalescePortEvents; // lvtk/ext/coalesce.hpp
+
 /** Vector of LV2UI_Descriptor's
     @headerfile lvtk/ui.hpp
     @ingroup ui
@@ -188,13 +196,19 @@ public:
 
     /** Write data to ports
 
+        With the @ref BatchWrites mixin this is sent at the end of the
+        idle tick instead.
+
         @param port
         @param size
         @param protocol
         @param data
      */
     inline void write (uint32_t port, uint32_t size, uint32_t protocol, const void* data) const {
-        controller.write (port, size, protocol, data);
+        if constexpr (std::is_base_of<BatchWrites<S>, S>::value)
+            const_cast<S*> (static_cast<const S*> (this))->batch_write (port, size, protocol, data);
+        else
+            controller.write (port, size, protocol, data);
     }
 
     /** Write a float to a control port */
@@ -210,6 +224,7 @@ protected:
 
 private:
     friend class UIDescriptor<S>; // so this can be private
+    friend struct BatchWrites<S>;
 
     inline static ExtensionMap& extensions() {
         static ExtensionMap s_extensions;
@@ -233,6 +248,7 @@ private:
                                       LV2UI_Controller ctl,
                                       LV2UI_Widget* widget,
                                       const LV2_Feature* const* features) {
+        LVTK_TRACE_SCOPE (ui_instantiate, 0);
         const UIArgs args (plugin_uri, bundle_path, { ctl, write_function }, features);
         auto instance = std::unique_ptr<S> (new S (args));
 
@@ -254,6 +270,9 @@ private:
     }
 
     static void _cleanup (LV2UI_Handle ui) {
+        LVTK_TRACE_SCOPE (ui_cleanup, 0);
+        if constexpr (std::is_base_of<BatchWrites<S>, S>::value)
+            (static_cast<S*> (ui))->flush_writes();
         (static_cast<S*> (ui))->cleanup();
         delete static_cast<S*> (ui);
     }
@@ -263,7 +282,12 @@ private:
                              uint32_t buffer_size,
                              uint32_t format,
                              const void* buffer) {
-        (static_cast<S*> (ui))->port_event (port_index, buffer_size, format, buffer);
+        LVTK_TRACE_SCOPE (port_event, port_index);
+        auto self = static_cast<S*> (ui);
+        if constexpr (std::is_base_of<CoalescePortEvents<S>, S>::value)
+            self->coalesce_port_event (port_index, buffer_size, format, buffer);
+        else
+            self->port_event (port_index, buffer_size, format, buffer);
     }
 
     static const void* _extension_data (const char* uri) {
@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
 #include <utility>
 
 namespace lvtk {
@@ -149,6 +154,279 @@ private:
     WeakStatus<Obj> _status;
 };
 
+namespace detail {
+
+/** @private Control block shared by an AtomicWeakStatus and its refs */
+struct WeakBlock {
+    std::atomic<void*> ptr { nullptr };    // the object, null once destroyed
+    std::atomic<uint32_t> refs { 0 };      // status + refs holding the block
+    std::atomic<uint32_t> active { 0 };    // WeakLocks in progress
+    std::atomic<uint32_t> next { 0 };      // free list link
+    uint32_t index = 0;
+};
+
+/** @private Lock-free pool of WeakBlocks.  Blocks are never freed, so
+    releasing one never touches the system allocator.
+ */
+class WeakBlockPool final {
+public:
+    static WeakBlockPool& instance() {
+        static WeakBlockPool s_pool;
+        return s_pool;
+    }
+
+    /** Take a block.  Grows the pool when empty, so not realtime safe. */
+    WeakBlock* acquire() {
+        for (;;) {
+            uint64_t head = _head.load (std::memory_order_acquire);
+            while (index_of (head) != none) {
+                WeakBlock* block  = get (index_of (head));
+                const uint64_t to = tagged (head, block->next.load (std::memory_order_relaxed));
+                if (_head.compare_exchange_weak (head, to, std::memory_order_acq_rel, std::memory_order_acquire))
+                    return block;
+            }
+            grow();
+        }
+    }
+
+    /** Return a block.  Lock-free, realtime safe. */
+    void release (WeakBlock* block) noexcept {
+        uint64_t head = _head.load (std::memory_order_relaxed);
+        do {
+            block->next.store (index_of (head), std::memory_order_relaxed);
+        } while (! _head.compare_exchange_weak (head, tagged (head, block->index), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+private:
+    static constexpr uint32_t none       = UINT32_MAX;
+    static constexpr uint32_t chunk_size = 256;
+    static constexpr uint32_t max_chunks = 4096;
+
+    std::atomic<uint64_t> _head { none };
+    std::atomic<WeakBlock*> _chunks[max_chunks] {};
+    uint32_t _num_chunks = 0;
+    std::mutex _grow;
+
+    WeakBlockPool() = default;
+
+    static uint32_t index_of (uint64_t head) noexcept { return static_cast<uint32_t> (head); }
+
+    // new head with the tag bumped, so a stale compare-exchange fails
+    static uint64_t tagged (uint64_t head, uint32_t index) noexcept {
+        return (((head >> 32) + 1) << 32) | index;
+    }
+
+    WeakBlock* get (uint32_t index) const noexcept {
+        return _chunks[index / chunk_size].load (std::memory_order_acquire) + (index % chunk_size);
+    }
+
+    void grow() {
+        std::lock_guard<std::mutex> lock (_grow);
+        if (index_of (_head.load (std::memory_order_acquire)) != none)
+            return; // another thread grew it
+        if (_num_chunks == max_chunks)
+            throw std::bad_alloc();
+
+        auto chunk = new WeakBlock[chunk_size];
+        for (uint32_t i = 0; i < chunk_size; ++i)
+            chunk[i].index = _num_chunks * chunk_size + i;
+        _chunks[_num_chunks++].store (chunk, std::memory_order_release);
+        for (uint32_t i = chunk_size; i > 0; --i)
+            release (chunk + i - 1);
+    }
+};
+
+/** @private */
+inline void weak_block_unref (WeakBlock* block) noexcept {
+    if (block != nullptr && block->refs.fetch_sub (1, std::memory_order_acq_rel) == 1)
+        WeakBlockPool::instance().release (block);
+}
+
+} // namespace detail
+
+/** Status of an object referenced by AtomicWeakRef.
+
+    Like WeakStatus, but safe when the object is destroyed on one thread
+    while another uses it, and allocation free after start up: control
+    blocks come from a lock-free pool and are returned to it by the last
+    reference, even from a realtime thread.
+
+    reset() with no arguments, called first thing in the destructor, waits
+    for every WeakLock on the object to go out of scope.  Never destroy an
+    object while holding a lock on it on the same thread.
+
+    @see AtomicWeakRef, LVTK_ATOMIC_WEAK_REFABLE
+    @headerfile lvtk/weak_ref.hpp
+ */
+template <class T>
+class AtomicWeakStatus final {
+public:
+    using owner_type = T;
+
+    AtomicWeakStatus() : _block (detail::WeakBlockPool::instance().acquire()) {
+        _block->ptr.store (nullptr, std::memory_order_relaxed);
+        _block->active.store (0, std::memory_order_relaxed);
+        _block->refs.store (1, std::memory_order_release);
+    }
+
+    ~AtomicWeakStatus() {
+        reset();
+        detail::weak_block_unref (_block);
+    }
+
+    /** Set to `this` in your constructor, or call with no arguments first
+        thing in your destructor.  Clearing waits for active locks.
+     */
+    void reset (T* ptr = nullptr) noexcept {
+        _block->ptr.store (ptr, std::memory_order_seq_cst);
+        if (ptr == nullptr)
+            while (_block->active.load (std::memory_order_seq_cst) != 0)
+                std::this_thread::yield();
+    }
+
+    /** Returns true if the pointer has not been cleared */
+    bool valid() const noexcept { return _block->ptr.load (std::memory_order_acquire) != nullptr; }
+
+    /** @private */
+    detail::WeakBlock* block() const noexcept { return _block; }
+
+private:
+    detail::WeakBlock* _block;
+
+    AtomicWeakStatus (const AtomicWeakStatus&)            = delete;
+    AtomicWeakStatus& operator= (const AtomicWeakStatus&) = delete;
+};
+
+/** A locked AtomicWeakRef.  The object can't be destroyed while one of
+    these is in scope.  Keep them short lived.
+    @headerfile lvtk/weak_ref.hpp
+ */
+template <class Obj>
+class WeakLock final {
+public:
+    WeakLock() = default;
+    WeakLock (WeakLock&& o) noexcept
+        : _block (std::exchange (o._block, nullptr)),
+          _ptr (std::exchange (o._ptr, nullptr)) {}
+    ~WeakLock() { unlock(); }
+
+    WeakLock& operator= (WeakLock&& o) noexcept {
+        if (this != &o) {
+            unlock();
+            _block = std::exchange (o._block, nullptr);
+            _ptr   = std::exchange (o._ptr, nullptr);
+        }
+        return *this;
+    }
+
+    /** Returns the object, or nullptr if it was destroyed */
+    Obj* get() const noexcept { return _ptr; }
+    Obj* operator->() const noexcept { return _ptr; }
+    Obj& operator*() const noexcept { return *_ptr; }
+    explicit operator bool() const noexcept { return _ptr != nullptr; }
+
+    /** Release the lock early */
+    void unlock() noexcept {
+        if (_block != nullptr)
+            _block->active.fetch_sub (1, std::memory_order_release);
+        _block = nullptr;
+        _ptr   = nullptr;
+    }
+
+private:
+    template <class>
+    friend class AtomicWeakRef;
+
+    detail::WeakBlock* _block = nullptr;
+    Obj* _ptr                 = nullptr;
+
+    explicit WeakLock (detail::WeakBlock* block) noexcept {
+        if (block == nullptr)
+            return;
+        block->active.fetch_add (1, std::memory_order_seq_cst);
+        if (auto ptr = block->ptr.load (std::memory_order_seq_cst)) {
+            _block = block;
+            _ptr   = static_cast<Obj*> (ptr);
+        } else {
+            block->active.fetch_sub (1, std::memory_order_release);
+        }
+    }
+
+    WeakLock (const WeakLock&)            = delete;
+    WeakLock& operator= (const WeakLock&) = delete;
+};
+
+/** A thread safe weak reference.
+
+    Add a status to your class with LVTK_ATOMIC_WEAK_REFABLE and set it in
+    the constructor and destructor, as with WeakRef.  Then lock() gives
+    access to the object only while it is alive, without locks or
+    allocation, so it can be used from realtime threads.
+
+    @code
+        lvtk::AtomicWeakRef<Widget> ref (widget);
+        ...
+        if (auto w = ref.lock())
+            w->repaint(); // can't be destroyed until `w` goes out of scope
+    @endcode
+
+    @see AtomicWeakStatus
+    @headerfile lvtk/weak_ref.hpp
+ */
+template <class Obj>
+class AtomicWeakRef final {
+public:
+    AtomicWeakRef() = default;
+    AtomicWeakRef (Obj* obj)
+        : _block (obj != nullptr ? Obj::lvtk_atomic_weak_status (obj).block() : nullptr) {
+        ref();
+    }
+
+    AtomicWeakRef (const AtomicWeakRef& o) noexcept : _block (o._block) { ref(); }
+    AtomicWeakRef (AtomicWeakRef&& o) noexcept : _block (std::exchange (o._block, nullptr)) {}
+    ~AtomicWeakRef() { detail::weak_block_unref (_block); }
+
+    AtomicWeakRef& operator= (const AtomicWeakRef& o) noexcept {
+        if (_block != o._block) {
+            detail::weak_block_unref (_block);
+            _block = o._block;
+            ref();
+        }
+        return *this;
+    }
+
+    AtomicWeakRef& operator= (AtomicWeakRef&& o) noexcept {
+        if (this != &o) {
+            detail::weak_block_unref (_block);
+            _block = std::exchange (o._block, nullptr);
+        }
+        return *this;
+    }
+
+    /** Returns a lock holding the object alive, empty if destroyed.
+        Realtime safe.
+     */
+    WeakLock<Obj> lock() const noexcept { return WeakLock<Obj> (_block); }
+
+    /** Returns true if the object hasn't been destroyed.  It may be by the
+        time this returns, use lock() to access it.
+     */
+    bool valid() const noexcept {
+        return _block != nullptr && _block->ptr.load (std::memory_order_acquire) != nullptr;
+    }
+
+    bool operator== (const AtomicWeakRef& o) const noexcept { return _block == o._block; }
+    bool operator!= (const AtomicWeakRef& o) const noexcept { return _block != o._block; }
+
+private:
+    detail::WeakBlock* _block = nullptr;
+
+    void ref() noexcept {
+        if (_block != nullptr)
+            _block->refs.fetch_add (1, std::memory_order_relaxed);
+    }
+};
+
 } // namespace lvtk
 
 #define LVTK_WEAK_REFABLE_WITH_MEMBER(klass, member)               \
@@ -186,3 +464,25 @@ private:
     @see WeakRef, WeakStatus
 */
 #define LVTK_WEAK_REFABLE(klass) LVTK_WEAK_REFABLE_WITH_MEMBER (klass, _weak_status)
+
+/** Adds an AtomicWeakStatus member named `_weak_status` for AtomicWeakRef.
+
+    @code
+    class Widget {
+    public:
+        Widget() { _weak_status.reset (this); }
+        ~Widget() { _weak_status.reset(); }
+
+    private:
+        LVTK_ATOMIC_WEAK_REFABLE (Widget)
+    };
+    @endcode
+
+    @see AtomicWeakRef
+*/
+#define LVTK_ATOMIC_WEAK_REFABLE(klass)                                          \
+    friend class lvtk::AtomicWeakRef<klass>;                                     \
+    lvtk::AtomicWeakStatus<klass> _weak_status;                                  \
+    static lvtk::AtomicWeakStatus<klass>& lvtk_atomic_weak_status (klass* obj) { \
+        return obj->_weak_status;                                                \
+    }
@@ -0,0 +1,151 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/arena.hpp>
+#include <lvtk/ext/instance_arena.hpp>
+
+#include <lv2/buf-size/buf-size.h>
+#include <lv2/options/options.h>
+
+#include <cstdint>
+
+struct ArenaPlug : lvtk::Plugin<ArenaPlug, lvtk::InstanceArena> {
+    static lvtk::ArenaOptions arena_options (const lvtk::Args&, const lvtk::BufferDetails& details) {
+        lvtk::ArenaOptions opts;
+        opts.size = sizeof (float) * details.max.value_or (256) * 2;
+        return opts;
+    }
+
+    ArenaPlug (const lvtk::Args& args) : Plugin (args) {
+        if (arena() == nullptr)
+            return;
+        const auto frames = buffer_details().max.value_or (256);
+        left              = arena()->make_array<float> (frames);
+        right             = arena()->make_array<float> (frames);
+    }
+
+    float* left  = nullptr;
+    float* right = nullptr;
+};
+
+class ArenaTest {
+public:
+    ArenaTest() {
+        subject = urid.map ("http://dummy.subject.org");
+        type    = urid.map ("http://www.w3.org/2001/XMLSchema#nonNegativeInteger");
+        options.add (LV2_OPTIONS_BLANK, subject, urid.map (LV2_BUF_SIZE__maxBlockLength), sizeof (uint32_t), type, &max_block);
+        options_feature.data = const_cast<lvtk::Option*> (options.get());
+    }
+
+    void allocate() {
+        lvtk::ArenaOptions opts;
+        opts.size  = 1000;
+        auto arena = lvtk::Arena::create (opts);
+        BOOST_REQUIRE (arena != nullptr);
+        BOOST_REQUIRE_GE (arena->capacity(), 1000u);
+        BOOST_REQUIRE_EQUAL (arena->used(), 0u);
+
+        auto a = arena->allocate (3);
+        auto b = arena->allocate (5);
+        auto c = arena->allocate (8, 8);
+        BOOST_REQUIRE_EQUAL ((uintptr_t) a % lvtk::Arena::cache_line, 0u);
+        BOOST_REQUIRE_EQUAL ((uintptr_t) b % lvtk::Arena::cache_line, 0u);
+        BOOST_REQUIRE_EQUAL ((uintptr_t) c % 8, 0u);
+        BOOST_REQUIRE ((uint8_t*) b >= (uint8_t*) a + 3);
+        BOOST_REQUIRE ((uint8_t*) c >= (uint8_t*) b + 5);
+        BOOST_REQUIRE (arena->owns (a) && arena->owns (c));
+
+        int local = 0;
+        BOOST_REQUIRE (! arena->owns (&local));
+
+        auto values = arena->make_array<double> (16);
+        BOOST_REQUIRE (values != nullptr);
+        for (int i = 0; i < 16; ++i)
+            BOOST_REQUIRE_EQUAL (values[i], 0.0);
+
+        // exhausted arenas return nullptr and stay usable
+        BOOST_REQUIRE (arena->allocate (arena->capacity()) == nullptr);
+        BOOST_REQUIRE (arena->allocate (SIZE_MAX) == nullptr);
+        const auto rest = arena->remaining();
+        BOOST_REQUIRE (arena->allocate (rest, 1) != nullptr);
+        BOOST_REQUIRE_EQUAL (arena->remaining(), 0u);
+        BOOST_REQUIRE (arena->make<int> (1) == nullptr);
+
+        lvtk::Arena::destroy (arena);
+
+        // sizes which can't be rounded up fail cleanly
+        opts.size = SIZE_MAX - 8;
+        BOOST_REQUIRE (lvtk::Arena::create (opts) == nullptr);
+
+        // huge pages are a hint, the arena works either way
+        opts.size       = 3 * 1024 * 1024;
+        opts.huge_pages = true;
+        arena           = lvtk::Arena::create (opts);
+        BOOST_REQUIRE (arena != nullptr);
+        auto big = arena->make_array<uint8_t> (opts.size);
+        BOOST_REQUIRE (big != nullptr);
+        big[opts.size - 1] = 1;
+        lvtk::Arena::destroy (arena);
+    }
+
+    void instance() {
+        lvtk::Descriptor<ArenaPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        const LV2_Feature* features[] = { urid.map_feature(), &options_feature, nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        auto plugin                   = static_cast<ArenaPlug*> (handle);
+        BOOST_REQUIRE (plugin != nullptr);
+
+        auto arena = plugin->arena();
+        BOOST_REQUIRE (arena != nullptr);
+        BOOST_REQUIRE (arena->owns (plugin));
+        BOOST_REQUIRE_EQUAL ((uintptr_t) plugin % lvtk::Arena::cache_line, 0u);
+        BOOST_REQUIRE_EQUAL (plugin->buffer_details().max.value_or (0), max_block);
+
+        // the buffers follow the plugin object
+        BOOST_REQUIRE (plugin->left != nullptr && plugin->right != nullptr);
+        BOOST_REQUIRE (arena->owns (plugin->right + max_block - 1));
+        BOOST_REQUIRE ((uint8_t*) plugin->left > (uint8_t*) plugin);
+        BOOST_REQUIRE (plugin->right >= plugin->left + max_block);
+        plugin->right[max_block - 1] = 1.f;
+
+        desc.cleanup (handle);
+        lvtk::descriptors().pop_back();
+    }
+
+    void not_hosted() {
+        // constructed directly there is no arena
+        lvtk::Args args;
+        ArenaPlug plugin (args);
+        BOOST_REQUIRE (plugin.arena() == nullptr);
+        BOOST_REQUIRE (plugin.left == nullptr);
+    }
+
+private:
+    lvtk::Symbols urid;
+    lvtk::OptionArray options;
+    LV2_Feature options_feature = { LV2_OPTIONS__options, nullptr };
+    uint32_t subject = 0, type = 0;
+    uint32_t max_block = 1024;
+};
+
+BOOST_AUTO_TEST_SUITE (Arena)
+
+BOOST_AUTO_TEST_CASE (allocate) {
+    ArenaTest().allocate();
+}
+
+BOOST_AUTO_TEST_CASE (instance) {
+    ArenaTest().instance();
+}
+
+BOOST_AUTO_TEST_CASE (not_hosted) {
+    ArenaTest().not_hosted();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,158 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/automation.hpp>
+#include <lvtk/ext/atom.hpp>
+#include <lvtk/symbols.hpp>
+
+#include <lv2/patch/patch.h>
+
+#include <vector>
+
+class AutomationTest {
+public:
+    AutomationTest() {
+        forge.init ((LV2_URID_Map*) symbols.map_feature()->data);
+        cutoff = symbols.map ("http://lvtoolkit.org/ns/lvtk#cutoff");
+        gain   = symbols.map ("http://lvtoolkit.org/ns/lvtk#gain");
+    }
+
+    void breakpoints() {
+        Automation automation ((LV2_URID_Map*) symbols.map_feature()->data);
+        const int c = automation.add_parameter (cutoff, 100.f);
+        const int g = automation.add_parameter (gain, 1.f);
+        BOOST_REQUIRE_EQUAL (c, 0);
+        BOOST_REQUIRE_EQUAL (g, 1);
+        BOOST_REQUIRE_EQUAL (automation.add_parameter (cutoff), 0);
+
+        begin();
+        set (16, cutoff, 200.f);
+        set (16, cutoff, 300.f); // same frame, last one wins
+        set (32, symbols.map ("http://lvtoolkit.org/ns/lvtk#unknown"), 5.f);
+        set_double (48, cutoff, 400.0);
+        set_int_property (40, cutoff, 900.f); // property not a URID, ignored
+        set (500, gain, 0.5f); // past the block, clamped
+        auto seq = end();
+
+        BOOST_REQUIRE_EQUAL (automation.scan (seq, 64), 4u);
+        const auto& points = automation.breakpoints (c);
+        BOOST_REQUIRE_EQUAL (points.size(), 2u);
+        BOOST_REQUIRE_EQUAL (points[0].frame, 16u);
+        BOOST_REQUIRE_EQUAL (points[0].value, 300.f);
+        BOOST_REQUIRE_EQUAL (points[1].frame, 48u);
+        BOOST_REQUIRE_EQUAL (points[1].value, 400.f);
+        BOOST_REQUIRE_EQUAL (automation.start_value (c), 100.f);
+        BOOST_REQUIRE_EQUAL (automation.value (c), 400.f);
+        BOOST_REQUIRE_EQUAL (automation.breakpoints (g)[0].frame, 63u);
+
+        std::vector<std::pair<uint32_t, uint32_t>> runs;
+        automation.segments (c, 64, [&] (uint32_t offset, uint32_t n, float) { runs.push_back ({ offset, n }); });
+        const std::vector<std::pair<uint32_t, uint32_t>> expected = { { 0, 16 }, { 16, 32 }, { 48, 16 } };
+        BOOST_REQUIRE (runs == expected);
+
+        // next block starts where this one ended
+        begin();
+        BOOST_REQUIRE_EQUAL (automation.scan (end(), 64), 0u);
+        BOOST_REQUIRE (! automation.changed (c));
+        BOOST_REQUIRE_EQUAL (automation.start_value (c), 400.f);
+    }
+
+    void render() {
+        const auto& k = lvtk::dsp::kernels();
+        Automation automation ((LV2_URID_Map*) symbols.map_feature()->data);
+        const int c = automation.add_parameter (cutoff, 0.f);
+
+        begin();
+        set (8, cutoff, 8.f);
+        set (16, cutoff, 0.f);
+        automation.scan (end(), 32);
+
+        std::vector<float> out (32, -1.f);
+        automation.render (k, c, out.data(), 32);
+        for (uint32_t i = 0; i < 32; ++i)
+            BOOST_REQUIRE_EQUAL (out[i], i >= 8 && i < 16 ? 8.f : 0.f);
+
+        automation.render (k, c, out.data(), 32, lvtk::AutomationCurve::LINEAR);
+        for (uint32_t i = 0; i <= 8; ++i)
+            BOOST_REQUIRE_CLOSE (out[i], (float) i, 1.0e-3);
+        for (uint32_t i = 8; i <= 16; ++i)
+            BOOST_REQUIRE_CLOSE (out[i] + 1.f, (float) (16 - i) + 1.f, 1.0e-3);
+        BOOST_REQUIRE_EQUAL (out[31], 0.f);
+
+        lvtk::dsp::Smoother smoother;
+        smoother.prepare (48000.0, 4.0 / 48000.0);
+        smoother.reset (0.f);
+        automation.render (k, c, smoother, out.data(), 32);
+        BOOST_REQUIRE_EQUAL (out[7], 0.f);
+        BOOST_REQUIRE_EQUAL (out[12], 8.f);
+        BOOST_REQUIRE_EQUAL (out[31], 0.f);
+    }
+
+private:
+    using Automation = lvtk::Automation<4, 8>;
+
+    lvtk::Symbols symbols;
+    lvtk::Forge forge;
+    lvtk::ForgeFrame frame;
+    alignas (8) uint8_t buffer[1024];
+    uint32_t cutoff = 0, gain = 0;
+
+    void begin() {
+        forge.set_buffer (buffer, sizeof (buffer));
+        forge.write_sequence_head (frame, 0);
+    }
+
+    const LV2_Atom_Sequence* end() {
+        forge.pop (frame);
+        return (const LV2_Atom_Sequence*) buffer;
+    }
+
+    void set (int64_t time, uint32_t property, float value) {
+        lvtk::ForgeFrame obj;
+        forge.write_frame_time (time);
+        forge.write_object (obj, 0, symbols.map (LV2_PATCH__Set));
+        forge.write_key (symbols.map (LV2_PATCH__property));
+        forge.write_urid (property);
+        forge.write_key (symbols.map (LV2_PATCH__value));
+        forge.write_float (value);
+        forge.pop (obj);
+    }
+
+    void set_int_property (int64_t time, uint32_t property, float value) {
+        lvtk::ForgeFrame obj;
+        forge.write_frame_time (time);
+        forge.write_object (obj, 0, symbols.map (LV2_PATCH__Set));
+        forge.write_key (symbols.map (LV2_PATCH__property));
+        forge.write_int ((int) property);
+        forge.write_key (symbols.map (LV2_PATCH__value));
+        forge.write_float (value);
+        forge.pop (obj);
+    }
+
+    void set_double (int64_t time, uint32_t property, double value) {
+        lvtk::ForgeFrame obj;
+        forge.write_frame_time (time);
+        forge.write_object (obj, 0, symbols.map (LV2_PATCH__Set));
+        forge.write_key (symbols.map (LV2_PATCH__value));
+        forge.write_double (value);
+        forge.write_key (symbols.map (LV2_PATCH__property));
+        forge.write_urid (property);
+        forge.pop (obj);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Automation)
+
+BOOST_AUTO_TEST_CASE (breakpoints) {
+    AutomationTest().breakpoints();
+}
+
+BOOST_AUTO_TEST_CASE (render) {
+    AutomationTest().render();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,282 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/atom.hpp>
+#include <lvtk/ext/batch_writes.hpp>
+#include <lvtk/ext/idle.hpp>
+#include <lvtk/symbols.hpp>
+#include <lvtk/ui.hpp>
+
+#include <lv2/patch/patch.h>
+#include <lv2/ui/ui.h>
+
+#include <cstring>
+#include <vector>
+
+struct BatchWritesUI : lvtk::UI<BatchWritesUI, lvtk::BatchWrites, lvtk::Idle> {
+    BatchWritesUI (const lvtk::UIArgs& args) : UI (args) {}
+
+    int idle() {
+        for (int i = 0; i < 50; ++i)
+            write (3, (float) i);
+        return 0;
+    }
+};
+
+class BatchWritesTest {
+public:
+    struct HostWrite {
+        uint32_t port, protocol;
+        std::vector<uint8_t> data;
+        bool aligned;
+
+        float value() const {
+            float v = 0.f;
+            std::memcpy (&v, data.data(), sizeof (float));
+            return v;
+        }
+    };
+
+    BatchWritesTest() {
+        forge.init ((LV2_URID_Map*) symbols.map_feature()->data);
+    }
+
+    void idle_flush() {
+        lvtk::UIDescriptor<BatchWritesUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        const LV2_Feature* features[] = { symbols.map_feature(), nullptr };
+        LV2UI_Widget widget           = nullptr;
+        auto handle                   = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", _write, this, &widget, features);
+        BOOST_REQUIRE (handle != nullptr);
+        auto ui          = static_cast<BatchWritesUI*> (handle);
+        const auto iface = (const LV2UI_Idle_Interface*) desc.extension_data (LV2_UI__idleInterface);
+
+        // writes made outside idle() wait for it
+        ui->write (1, 0.25f);
+        ui->write (1, 0.5f);
+        BOOST_REQUIRE (writes.empty());
+        BOOST_REQUIRE_EQUAL (ui->pending_writes(), 1u);
+
+        iface->idle (handle);
+        BOOST_REQUIRE_EQUAL (writes.size(), 2u);
+        BOOST_REQUIRE_EQUAL (writes[0].port, 1u);
+        BOOST_REQUIRE_EQUAL (writes[0].value(), 0.5f);
+        BOOST_REQUIRE_EQUAL (writes[1].port, 3u);
+        BOOST_REQUIRE_EQUAL (writes[1].value(), 49.f);
+        BOOST_REQUIRE_EQUAL (ui->batch_stats().queued, 52u);
+        BOOST_REQUIRE_EQUAL (ui->batch_stats().merged, 50u);
+        BOOST_REQUIRE_EQUAL (ui->batch_stats().written, 2u);
+
+        // pending writes go out before cleanup
+        writes.clear();
+        ui->write (2, 1.f);
+        desc.cleanup (handle);
+        BOOST_REQUIRE_EQUAL (writes.size(), 1u);
+        BOOST_REQUIRE_EQUAL (writes[0].port, 2u);
+
+        lvtk::ui_descriptors().pop_back();
+    }
+
+    void patch_set() {
+        lvtk::UIDescriptor<BatchWritesUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        const LV2_Feature* features[] = { symbols.map_feature(), nullptr };
+        LV2UI_Widget widget           = nullptr;
+        auto handle                   = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", _write, this, &widget, features);
+        auto ui                       = static_cast<BatchWritesUI*> (handle);
+
+        const auto transfer = symbols.map (LV2_ATOM__eventTransfer);
+        const auto gain     = symbols.map ("urn:test:gain");
+        const auto cutoff   = symbols.map ("urn:test:cutoff");
+
+        set (ui, 5, gain, 1.f);
+        set (ui, 5, cutoff, 100.f);
+        set (ui, 5, gain, 2.f);
+        set (ui, 6, gain, 3.f); // other port, not merged
+        const uint8_t raw[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        ui->write (5, sizeof (raw), 99, raw); // other protocol, untouched
+        BOOST_REQUIRE_EQUAL (ui->pending_writes(), 4u);
+        BOOST_REQUIRE_EQUAL (ui->batch_stats().merged, 1u);
+
+        BOOST_REQUIRE_EQUAL (ui->flush_writes(), 4u);
+        BOOST_REQUIRE_EQUAL (writes.size(), 4u);
+        BOOST_REQUIRE_EQUAL (set_value (writes[0]), 100.f);
+        BOOST_REQUIRE_EQUAL (set_value (writes[1]), 2.f);
+        BOOST_REQUIRE_EQUAL (writes[2].port, 6u);
+        BOOST_REQUIRE_EQUAL (writes[3].protocol, 99u);
+        BOOST_REQUIRE_EQUAL (writes[0].protocol, transfer);
+
+        // one tuple per port
+        writes.clear();
+        ui->set_tuple_batching (true);
+        BOOST_REQUIRE (ui->tuple_batching());
+        set (ui, 5, gain, 4.f);
+        set (ui, 6, gain, 5.f);
+        set (ui, 5, cutoff, 200.f);
+        BOOST_REQUIRE_EQUAL (ui->flush_writes(), 2u);
+        BOOST_REQUIRE_EQUAL (writes.size(), 2u);
+        BOOST_REQUIRE_EQUAL (writes[0].port, 5u);
+        BOOST_REQUIRE_EQUAL (writes[0].protocol, transfer);
+
+        auto tuple = reinterpret_cast<const LV2_Atom*> (writes[0].data.data());
+        BOOST_REQUIRE_EQUAL (tuple->type, symbols.map (LV2_ATOM__Tuple));
+        BOOST_REQUIRE_EQUAL (sizeof (LV2_Atom) + tuple->size, writes[0].data.size());
+        std::vector<float> values;
+        auto end = writes[0].data.data() + writes[0].data.size();
+        for (auto item = tuple + 1; (const uint8_t*) item < end; item = lv2_atom_tuple_next (item))
+            values.push_back (set_value (item));
+        BOOST_REQUIRE_EQUAL (values.size(), 2u);
+        BOOST_REQUIRE_EQUAL (values[0], 4.f);
+        BOOST_REQUIRE_EQUAL (values[1], 200.f);
+        BOOST_REQUIRE_EQUAL (writes[1].data.size(), sizeof (LV2_Atom) + set_size);
+
+        // discarded writes never reach the host
+        writes.clear();
+        ui->write (1, 1.f);
+        set (ui, 5, gain, 6.f);
+        ui->discard_writes();
+        BOOST_REQUIRE_EQUAL (ui->pending_writes(), 0u);
+        desc.cleanup (handle);
+        BOOST_REQUIRE (writes.empty());
+
+        lvtk::ui_descriptors().pop_back();
+    }
+
+    void alignment() {
+        lvtk::UIDescriptor<BatchWritesUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        const LV2_Feature* features[] = { symbols.map_feature(), nullptr };
+        LV2UI_Widget widget           = nullptr;
+        auto handle                   = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", _write, this, &widget, features);
+        auto ui                       = static_cast<BatchWritesUI*> (handle);
+        const auto gain               = symbols.map ("urn:test:gain");
+
+        // an odd sized write first, the objects after it must stay aligned
+        const uint8_t raw[] = { 1, 2, 3 };
+        ui->write (5, sizeof (raw), 99, raw);
+        set (ui, 5, gain, 1.f);
+        ui->write (5, sizeof (raw), 99, raw);
+        set (ui, 6, gain, 2.f);
+        BOOST_REQUIRE_EQUAL (ui->flush_writes(), 4u);
+
+        BOOST_REQUIRE_EQUAL (writes.size(), 4u);
+        for (const auto& w : writes)
+            BOOST_REQUIRE (w.aligned);
+        BOOST_REQUIRE_EQUAL (writes[0].data.size(), sizeof (raw));
+        BOOST_REQUIRE_EQUAL (set_value (writes[1]), 1.f);
+        BOOST_REQUIRE_EQUAL (set_value (writes[3]), 2.f);
+
+        desc.cleanup (handle);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+    void reentrant() {
+        lvtk::UIDescriptor<BatchWritesUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        const LV2_Feature* features[] = { symbols.map_feature(), nullptr };
+        LV2UI_Widget widget           = nullptr;
+        auto handle                   = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", _write, this, &widget, features);
+        auto ui                       = static_cast<BatchWritesUI*> (handle);
+
+        const uint8_t raw[] = { 1, 2, 3, 4, 5 };
+        ui->write (1, 0.5f);
+        ui->write (2, sizeof (raw), 99, raw);
+        ui->write (3, sizeof (raw), 99, raw);
+
+        // every host write makes the UI write again
+        echo = ui;
+        BOOST_REQUIRE_EQUAL (ui->flush_writes(), 3u);
+        echo = nullptr;
+        BOOST_REQUIRE_EQUAL (writes.size(), 3u);
+        BOOST_REQUIRE_EQUAL (writes[0].value(), 0.5f);
+        BOOST_REQUIRE (writes[1].data == std::vector<uint8_t> (raw, raw + sizeof (raw)));
+        BOOST_REQUIRE (writes[2].data == std::vector<uint8_t> (raw, raw + sizeof (raw)));
+
+        // what was written during the flush goes out with the next one
+        BOOST_REQUIRE_EQUAL (ui->pending_writes(), 3u * 40u);
+        writes.clear();
+        BOOST_REQUIRE_EQUAL (ui->flush_writes(), 3u * 40u);
+        BOOST_REQUIRE_EQUAL (writes.size(), 3u * 40u);
+        BOOST_REQUIRE_EQUAL (writes[0].port, 120u);
+        BOOST_REQUIRE_EQUAL (writes[59].value(), 19.f);
+        BOOST_REQUIRE_EQUAL (ui->pending_writes(), 0u);
+
+        desc.cleanup (handle);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+private:
+    lvtk::Symbols symbols;
+    lvtk::Forge forge;
+    uint8_t buffer[256];
+    uint32_t set_size = 0;
+    std::vector<HostWrite> writes;
+    BatchWritesUI* echo = nullptr;
+
+    static void _write (LV2UI_Controller controller, uint32_t port, uint32_t size, uint32_t protocol, const void* data) {
+        auto self  = static_cast<BatchWritesTest*> (controller);
+        auto bytes = static_cast<const uint8_t*> (data);
+        self->writes.push_back ({ port, protocol, { bytes, bytes + size }, reinterpret_cast<uintptr_t> (data) % 8 == 0 });
+
+        // a UI answering the host's feedback from inside the write
+        if (self->echo != nullptr && port < 100) {
+            const uint8_t raw[] = { 9, 9, 9 };
+            for (uint32_t i = 0; i < 20; ++i) {
+                self->echo->write (100 + port * 20 + i, (float) i);
+                self->echo->write (100 + port, sizeof (raw), 99, raw);
+            }
+        }
+    }
+
+    void set (BatchWritesUI* ui, uint32_t port, uint32_t property, float value) {
+        forge.set_buffer (buffer, sizeof (buffer));
+        lvtk::ForgeFrame frame;
+        auto obj = forge.write_object (frame, 0, symbols.map (LV2_PATCH__Set));
+        forge.write_key (symbols.map (LV2_PATCH__property));
+        forge.write_urid (property);
+        forge.write_key (symbols.map (LV2_PATCH__value));
+        forge.write_float (value);
+        forge.pop (frame);
+        auto atom = (const LV2_Atom*) obj;
+        set_size  = (uint32_t) sizeof (LV2_Atom) + atom->size;
+        ui->write (port, set_size, symbols.map (LV2_ATOM__eventTransfer), atom);
+    }
+
+    float set_value (const LV2_Atom* atom) {
+        const LV2_Atom* value = nullptr;
+        lv2_atom_object_get ((const LV2_Atom_Object*) atom, symbols.map (LV2_PATCH__value), &value, 0);
+        return value != nullptr ? ((const LV2_Atom_Float*) value)->body : -1.f;
+    }
+
+    float set_value (const HostWrite& w) {
+        return set_value ((const LV2_Atom*) w.data.data());
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (BatchWrites)
+
+BOOST_AUTO_TEST_CASE (idle_flush) {
+    BatchWritesTest().idle_flush();
+}
+
+BOOST_AUTO_TEST_CASE (patch_set) {
+    BatchWritesTest().patch_set();
+}
+
+BOOST_AUTO_TEST_CASE (alignment) {
+    BatchWritesTest().alignment();
+}
+
+BOOST_AUTO_TEST_CASE (reentrant) {
+    BatchWritesTest().reentrant();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,70 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/** A named benchmark suite. Each suite prints one line per measurement. */
+struct Suite {
+    const char* name;
+    void (*run)();
+};
+
+inline std::vector<Suite>& suites() {
+    static std::vector<Suite> s_suites;
+    return s_suites;
+}
+
+/** Registers a suite at static init time. Use BENCH_SUITE instead. */
+struct Register {
+    Register (const char* name, void (*fn)()) { suites().push_back ({ name, fn }); }
+};
+
+/** Prevent the optimizer from discarding a result */
+template <typename T>
+inline void keep (T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile ("" : : "r,m"(value) : "memory");
+#else
+    static volatile T sink;
+    sink = value;
+#endif
+}
+
+/** Time `fn` for at least `min_ms` milliseconds and print the mean
+    nanoseconds per call. Returns that mean.
+ */
+inline double measure (const std::string& label, const std::function<void()>& fn, double min_ms = 50.0) {
+    using clock = std::chrono::steady_clock;
+    for (int i = 0; i < 16; ++i)
+        fn(); // warm up caches and branch predictors
+
+    uint64_t iterations = 0;
+    const auto start    = clock::now();
+    double elapsed_ms   = 0.0;
+    do {
+        for (int i = 0; i < 64; ++i)
+            fn();
+        iterations += 64;
+        elapsed_ms = std::chrono::duration<double, std::milli> (clock::now() - start).count();
+    } while (elapsed_ms < min_ms);
+
+    const double ns = elapsed_ms * 1.0e6 / (double) iterations;
+    std::printf ("  %-40s %12.2f ns\n", label.c_str(), ns);
+    return ns;
+}
+
+} // namespace bench
+
+#define BENCH_SUITE(name)                                                \
+    static void bench_suite_##name();                                   \
+    static const bench::Register bench_register_##name (#name, bench_suite_##name); \
+    static void bench_suite_##name()
@@ -0,0 +1,164 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/coalesce.hpp>
+#include <lvtk/ext/idle.hpp>
+#include <lvtk/ui.hpp>
+
+#include <lv2/atom/atom.h>
+#include <lv2/ui/ui.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct CoalesceUI : lvtk::UI<CoalesceUI, lvtk::CoalescePortEvents, lvtk::Idle> {
+    CoalesceUI (const lvtk::UIArgs& args) : UI (args) {
+        set_message_queue_capacity (3, 64);
+    }
+
+    struct Event {
+        uint32_t port, format;
+        float value;
+        std::string message;
+        bool aligned;
+    };
+
+    void port_event (uint32_t port, uint32_t size, uint32_t format, const void* data) {
+        Event ev { port, format, 0.f, {}, reinterpret_cast<uintptr_t> (data) % 8 == 0 };
+        if (format == 0)
+            std::memcpy (&ev.value, data, sizeof (float));
+        else
+            ev.message.assign (static_cast<const char*> (data), size);
+        events.push_back (ev);
+    }
+
+    int idle() {
+        ++ticks;
+        return 0;
+    }
+
+    std::vector<Event> events;
+    int ticks = 0;
+};
+
+class CoalesceTest {
+public:
+    void idle_delivery() {
+        lvtk::UIDescriptor<CoalesceUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        const LV2_Feature* features[] = { nullptr };
+        LV2UI_Widget widget           = nullptr;
+        auto handle                   = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", nullptr, nullptr, &widget, features);
+        BOOST_REQUIRE (handle != nullptr);
+        auto ui    = static_cast<CoalesceUI*> (handle);
+        auto iface = (const LV2UI_Idle_Interface*) desc.extension_data (LV2_UI__idleInterface);
+        BOOST_REQUIRE (iface != nullptr);
+
+        const uint32_t atom = 1; // any non-zero format is queued as is
+        for (int i = 0; i < 100; ++i) {
+            const float gain = (float) i;
+            desc.port_event (handle, 4, sizeof (float), 0, &gain);
+        }
+        const float freq = 440.f;
+        desc.port_event (handle, 2, sizeof (float), 0, &freq);
+        desc.port_event (handle, 7, 3, atom, "one");
+        desc.port_event (handle, 7, 3, atom, "two");
+        desc.port_event (handle, 7, 5, atom, "three");
+        desc.port_event (handle, 7, 4, atom, "four");
+
+        BOOST_REQUIRE (ui->events.empty());
+        BOOST_REQUIRE_EQUAL (ui->pending_port_events(), 5u);
+
+        BOOST_REQUIRE_EQUAL (iface->idle (handle), 0);
+        BOOST_REQUIRE_EQUAL (ui->ticks, 1);
+        BOOST_REQUIRE_EQUAL (ui->events.size(), 5u);
+        BOOST_REQUIRE_EQUAL (ui->events[0].port, 4u);
+        BOOST_REQUIRE_EQUAL (ui->events[0].value, 99.f);
+        BOOST_REQUIRE_EQUAL (ui->events[1].port, 2u);
+        BOOST_REQUIRE_EQUAL (ui->events[1].value, 440.f);
+        BOOST_REQUIRE_EQUAL (ui->events[2].message, "one");
+        BOOST_REQUIRE_EQUAL (ui->events[3].message, "two");
+        BOOST_REQUIRE_EQUAL (ui->events[4].message, "three");
+        BOOST_REQUIRE_EQUAL (ui->events[4].format, atom);
+
+        const auto& stats = ui->coalesce_stats();
+        BOOST_REQUIRE_EQUAL (stats.received, 105u);
+        BOOST_REQUIRE_EQUAL (stats.merged, 99u);
+        BOOST_REQUIRE_EQUAL (stats.dropped, 1u);
+        BOOST_REQUIRE_EQUAL (stats.delivered, 5u);
+
+        // nothing new, nothing delivered
+        ui->events.clear();
+        iface->idle (handle);
+        BOOST_REQUIRE (ui->events.empty());
+
+        desc.port_event (handle, 4, sizeof (float), 0, &freq);
+        BOOST_REQUIRE_EQUAL (ui->deliver_port_events(), 1u);
+        BOOST_REQUIRE_EQUAL (ui->events.front().value, 440.f);
+
+        ui->reset_coalesce_stats();
+        BOOST_REQUIRE_EQUAL (ui->coalesce_stats().received, 0u);
+
+        desc.cleanup (handle);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+    void alignment() {
+        lvtk::UIDescriptor<CoalesceUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        const LV2_Feature* features[] = { nullptr };
+        LV2UI_Widget widget           = nullptr;
+        auto handle                   = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", nullptr, nullptr, &widget, features);
+        BOOST_REQUIRE (handle != nullptr);
+        auto ui = static_cast<CoalesceUI*> (handle);
+
+        // an odd sized message, then an object which must stay readable
+        struct {
+            LV2_Atom_Object object;
+            LV2_Atom_Property_Body prop;
+            int32_t value;
+            int32_t pad;
+        } obj = {};
+        obj.object.atom.size  = sizeof (obj) - sizeof (LV2_Atom);
+        obj.object.atom.type  = 10;
+        obj.object.body.otype = 20;
+        obj.prop.key          = 30;
+        obj.prop.value.size   = sizeof (int32_t);
+        obj.value             = 42;
+
+        const uint32_t atom = 1;
+        desc.port_event (handle, 7, 3, atom, "odd");
+        desc.port_event (handle, 7, sizeof (obj), atom, &obj);
+        desc.port_event (handle, 7, 5, atom, "three");
+        BOOST_REQUIRE_EQUAL (ui->deliver_port_events(), 3u);
+
+        BOOST_REQUIRE_EQUAL (ui->events.size(), 3u);
+        for (const auto& ev : ui->events)
+            BOOST_REQUIRE (ev.aligned);
+        BOOST_REQUIRE_EQUAL (ui->events[0].message, "odd");
+        BOOST_REQUIRE (ui->events[1].message == std::string ((const char*) &obj, sizeof (obj)));
+        BOOST_REQUIRE_EQUAL (ui->events[2].message, "three");
+
+        desc.cleanup (handle);
+        lvtk::ui_descriptors().pop_back();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Coalesce)
+
+BOOST_AUTO_TEST_CASE (idle_delivery) {
+    CoalesceTest().idle_delivery();
+}
+
+BOOST_AUTO_TEST_CASE (alignment) {
+    CoalesceTest().alignment();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/flat_map.hpp>
+#include <lvtk/ring_deque.hpp>
+#include <lvtk/static_vector.hpp>
+
+#include <memory>
+#include <string>
+
+class ContainersTest {
+public:
+    void static_vector() {
+        lvtk::StaticVector<std::string, 4> vec;
+        BOOST_REQUIRE (vec.empty());
+        BOOST_REQUIRE_EQUAL (vec.capacity(), 4u);
+
+        BOOST_REQUIRE (vec.push_back ("a"));
+        BOOST_REQUIRE (vec.push_back ("c"));
+        BOOST_REQUIRE (vec.emplace_back (3, 'd') != nullptr);
+        BOOST_REQUIRE_EQUAL (*vec.insert (vec.begin() + 1, "b"), "b");
+        BOOST_REQUIRE (vec.full());
+        BOOST_REQUIRE (! vec.push_back ("e"));
+        BOOST_REQUIRE (vec.insert (vec.begin(), "z") == vec.end());
+        BOOST_REQUIRE_EQUAL (vec.size(), 4u);
+        BOOST_REQUIRE_EQUAL (vec[0], "a");
+        BOOST_REQUIRE_EQUAL (vec[1], "b");
+        BOOST_REQUIRE_EQUAL (vec[2], "c");
+        BOOST_REQUIRE_EQUAL (vec.back(), "ddd");
+
+        auto copy = vec;
+        vec.erase (vec.begin());
+        BOOST_REQUIRE_EQUAL (vec.front(), "b");
+        vec.swap_remove (vec.begin());
+        BOOST_REQUIRE_EQUAL (vec.front(), "ddd");
+        BOOST_REQUIRE_EQUAL (vec.size(), 2u);
+        BOOST_REQUIRE_EQUAL (copy.size(), 4u);
+        BOOST_REQUIRE_EQUAL (copy.front(), "a");
+
+        // elements are destroyed
+        auto shared = std::make_shared<int> (1);
+        {
+            lvtk::StaticVector<std::shared_ptr<int>, 2> owners;
+            owners.push_back (shared);
+            owners.push_back (shared);
+            BOOST_REQUIRE_EQUAL (shared.use_count(), 3);
+            owners.pop_back();
+            BOOST_REQUIRE_EQUAL (shared.use_count(), 2);
+        }
+        BOOST_REQUIRE_EQUAL (shared.use_count(), 1);
+    }
+
+    void ring_deque() {
+        lvtk::RingDeque<int, 4> ring;
+        BOOST_REQUIRE (ring.empty());
+        for (int round = 0; round < 10; ++round) {
+            BOOST_REQUIRE (ring.push_back (2));
+            BOOST_REQUIRE (ring.push_back (3));
+            BOOST_REQUIRE (ring.push_front (1));
+            BOOST_REQUIRE (ring.push_front (0));
+            BOOST_REQUIRE (ring.full());
+            BOOST_REQUIRE (! ring.push_back (4));
+            BOOST_REQUIRE (! ring.push_front (-1));
+            for (int i = 0; i < 4; ++i)
+                BOOST_REQUIRE_EQUAL (ring[i], i);
+
+            BOOST_REQUIRE_EQUAL (ring.front(), 0);
+            BOOST_REQUIRE_EQUAL (ring.back(), 3);
+            ring.pop_front();
+            ring.pop_back();
+            BOOST_REQUIRE_EQUAL (ring.front(), 1);
+            BOOST_REQUIRE_EQUAL (ring.back(), 2);
+
+            // leave one behind so the head moves around the ring
+            ring.pop_back();
+            BOOST_REQUIRE (ring.push_back (9));
+            ring.pop_front();
+            BOOST_REQUIRE_EQUAL (ring.size(), 1u);
+            ring.pop_front();
+        }
+        BOOST_REQUIRE (ring.empty());
+    }
+
+    void flat_map() {
+        lvtk::FlatMap<int, 4> map;
+        BOOST_REQUIRE (map.find (1) == nullptr);
+        BOOST_REQUIRE (map.insert (30, 3));
+        BOOST_REQUIRE (map.insert (10, 1));
+        BOOST_REQUIRE (map.insert (20, 2));
+        BOOST_REQUIRE (map.insert (40, 4));
+        BOOST_REQUIRE (map.full());
+        BOOST_REQUIRE (! map.insert (50, 5));
+        BOOST_REQUIRE (map.insert (20, 22));
+
+        uint32_t last = 0;
+        for (const auto& item : map) {
+            BOOST_REQUIRE_GT (item.first, last);
+            last = item.first;
+        }
+
+        BOOST_REQUIRE_EQUAL (*map.find (20), 22);
+        BOOST_REQUIRE_EQUAL (*map.find (40), 4);
+        BOOST_REQUIRE (! map.contains (25));
+        BOOST_REQUIRE (map.erase (10));
+        BOOST_REQUIRE (! map.erase (10));
+        BOOST_REQUIRE_EQUAL (map.size(), 3u);
+        BOOST_REQUIRE_EQUAL (*map.find (30), 3);
+        BOOST_REQUIRE (map.insert (5, 0));
+        BOOST_REQUIRE_EQUAL (map.begin()->first, 5u);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Containers)
+
+BOOST_AUTO_TEST_CASE (static_vector) {
+    ContainersTest().static_vector();
+}
+
+BOOST_AUTO_TEST_CASE (ring_deque) {
+    ContainersTest().ring_deque();
+}
+
+BOOST_AUTO_TEST_CASE (flat_map) {
+    ContainersTest().flat_map();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,114 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/dsp/denormal.hpp>
+
+#include <cfloat>
+
+namespace {
+// keeps the compiler from folding the arithmetic at build time
+volatile float tiny = FLT_MIN;
+
+float underflow() {
+    return tiny * 0.25f; // denormal without FTZ, zero with it
+}
+} // namespace
+
+struct DenormalPlug : lvtk::Plugin<DenormalPlug, lvtk::FlushDenormals, lvtk::Worker> {
+    DenormalPlug (const lvtk::Args& args) : Plugin (args) {}
+
+    bool flushed_in_run      = false;
+    bool flushed_in_response = false;
+    float result             = 1.f;
+
+    void run (uint32_t) {
+        flushed_in_run = lvtk::dsp::denormals_flushed();
+        result         = underflow();
+    }
+
+    lvtk::WorkerStatus work_response (uint32_t, const void*) {
+        flushed_in_response = lvtk::dsp::denormals_flushed();
+        return LV2_WORKER_SUCCESS;
+    }
+};
+
+class DenormalTest {
+public:
+    void scope() {
+        const bool before = lvtk::dsp::denormals_flushed();
+        lvtk::dsp::DenormalStats stats;
+        {
+            lvtk::dsp::DenormalScope s (&stats);
+            if (! supported())
+                return;
+            BOOST_REQUIRE (lvtk::dsp::denormals_flushed());
+            BOOST_REQUIRE_EQUAL (underflow(), 0.f);
+        }
+        BOOST_REQUIRE_EQUAL (lvtk::dsp::denormals_flushed(), before);
+        BOOST_REQUIRE_NE (underflow(), 0.f);
+        BOOST_REQUIRE_EQUAL (stats.blocks.load(), 1u);
+        BOOST_REQUIRE_EQUAL (stats.flushed.load(), 1u);
+
+        {
+            lvtk::dsp::DenormalScope s (&stats);
+            volatile float x = 1.f;
+            x                = x * 0.5f;
+        }
+        BOOST_REQUIRE_EQUAL (stats.blocks.load(), 2u);
+        BOOST_REQUIRE_EQUAL (stats.flushed.load(), 1u);
+    }
+
+    void plugin() {
+        lvtk::Descriptor<DenormalPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        const LV2_Feature* features[] = { nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        auto plugin                   = static_cast<DenormalPlug*> (handle);
+        BOOST_REQUIRE (plugin != nullptr);
+
+        plugin->count_denormals (true);
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->denormal_stats().blocks.load(), 1u);
+
+        auto iface = (const LV2_Worker_Interface*) desc.extension_data (LV2_WORKER__interface);
+        BOOST_REQUIRE (iface != nullptr);
+        iface->work_response (handle, 0, nullptr);
+        BOOST_REQUIRE_EQUAL (plugin->denormal_stats().blocks.load(), 2u);
+
+        if (supported()) {
+            BOOST_REQUIRE (plugin->flushed_in_run);
+            BOOST_REQUIRE (plugin->flushed_in_response);
+            BOOST_REQUIRE_EQUAL (plugin->result, 0.f);
+            BOOST_REQUIRE_EQUAL (plugin->denormal_stats().flushed.load(), 1u);
+            BOOST_REQUIRE (! lvtk::dsp::denormals_flushed());
+        }
+
+        plugin->reset_denormal_stats();
+        plugin->count_denormals (false);
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->denormal_stats().blocks.load(), 0u);
+
+        desc.cleanup (handle);
+        lvtk::descriptors().pop_back();
+    }
+
+private:
+    static bool supported() { return LVTK_DSP_MXCSR || LVTK_DSP_FPCR; }
+};
+
+BOOST_AUTO_TEST_SUITE (Denormal)
+
+BOOST_AUTO_TEST_CASE (scope) {
+    DenormalTest().scope();
+}
+
+BOOST_AUTO_TEST_CASE (plugin) {
+    DenormalTest().plugin();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
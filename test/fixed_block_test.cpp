@@ -0,0 +1,97 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/fixed_block.hpp>
+
+struct FixedPlug : lvtk::Plugin<FixedPlug, lvtk::FixedBlockRun> {
+    FixedPlug (const lvtk::Args& args) : Plugin (args) {}
+
+    template <uint32_t N>
+    void run_fixed() {
+        last_fixed = N;
+    }
+
+    void run (uint32_t nframes) { last_generic = nframes; }
+
+    uint32_t last_fixed   = 0;
+    uint32_t last_generic = 0;
+};
+
+struct DefaultFixedPlug : lvtk::Plugin<DefaultFixedPlug, lvtk::FixedBlockRun> {
+    DefaultFixedPlug (const lvtk::Args& args) : Plugin (args) {}
+    void run (uint32_t nframes) { last = nframes; }
+    uint32_t last = 0;
+};
+
+class FixedBlockTest {
+public:
+    void dispatch() {
+        lvtk::Descriptor<FixedPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        LV2_Feature fixed             = { LV2_BUF_SIZE__fixedBlockLength, nullptr };
+        const LV2_Feature* features[] = { &fixed, nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        auto plugin                   = static_cast<FixedPlug*> (handle);
+        BOOST_REQUIRE (plugin != nullptr);
+        BOOST_REQUIRE (plugin->fixed_block_length());
+        BOOST_REQUIRE (! plugin->power_of_two_block_length());
+
+        for (uint32_t n = 32; n <= 1024; n *= 2) {
+            desc.run (handle, n);
+            BOOST_REQUIRE_EQUAL (plugin->last_fixed, n);
+        }
+        BOOST_REQUIRE_EQUAL (plugin->fixed_blocks(), 6u);
+        BOOST_REQUIRE_EQUAL (plugin->last_generic, 0u);
+
+        for (uint32_t n : { 0u, 16u, 100u, 2048u }) {
+            desc.run (handle, n);
+            BOOST_REQUIRE_EQUAL (plugin->last_generic, n);
+        }
+        BOOST_REQUIRE_EQUAL (plugin->generic_blocks(), 4u);
+        BOOST_REQUIRE_EQUAL (plugin->fixed_blocks(), 6u);
+        desc.cleanup (handle);
+    }
+
+    void default_run() {
+        lvtk::Descriptor<DefaultFixedPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        const LV2_Feature* features[] = { nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        auto plugin                   = static_cast<DefaultFixedPlug*> (handle);
+        BOOST_REQUIRE (! plugin->fixed_block_length());
+        desc.run (handle, 256);
+        BOOST_REQUIRE_EQUAL (plugin->last, 256u);
+        BOOST_REQUIRE_EQUAL (plugin->fixed_blocks(), 1u);
+        desc.cleanup (handle);
+    }
+
+    void buffer_details() {
+        lvtk::BufferDetails details;
+        BOOST_REQUIRE (! details.apply_feature (lvtk::Feature { LV2_URID__map, nullptr }));
+        BOOST_REQUIRE (details.apply_feature (lvtk::Feature { LV2_BUF_SIZE__powerOf2BlockLength, nullptr }));
+        BOOST_REQUIRE (details.power_of_two);
+        BOOST_REQUIRE (! details.fixed_length);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (FixedBlock)
+
+BOOST_AUTO_TEST_CASE (dispatch) {
+    FixedBlockTest().dispatch();
+}
+
+BOOST_AUTO_TEST_CASE (default_run) {
+    FixedBlockTest().default_run();
+}
+
+BOOST_AUTO_TEST_CASE (buffer_details) {
+    FixedBlockTest().buffer_details();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,148 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/idle.hpp>
+#include <lvtk/ext/idle_scheduler.hpp>
+#include <lvtk/ui.hpp>
+
+#include <lv2/ui/ui.h>
+
+struct IdleSchedulerUI : lvtk::UI<IdleSchedulerUI, lvtk::Idle, lvtk::IdleScheduler> {
+    IdleSchedulerUI (const lvtk::UIArgs& args) : UI (args) {
+        meters = add_idle_task (30.0, [this] { ++meter_draws; });
+        text   = add_idle_task (4.0, [this] { ++text_draws; }, lvtk::IdleTaskMode::WHEN_CHANGED);
+    }
+
+    int idle() {
+        ++idles;
+        return 0;
+    }
+
+    uint32_t meters, text;
+    int meter_draws = 0, text_draws = 0, idles = 0;
+};
+
+class IdleSchedulerTest {
+public:
+    void rates() {
+        lvtk::UIDescriptor<IdleSchedulerUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+        auto ui          = instantiate (desc);
+
+        // one simulated second of host idle calls at 1 kHz
+        const uint64_t ms = 1000000;
+        ui->run_idle_tasks (1 * ms); // both run on the first tick
+        for (uint64_t t = 2; t <= 1000; ++t)
+            ui->run_idle_tasks (t * ms);
+        BOOST_REQUIRE_EQUAL (ui->meter_draws, 30);
+        BOOST_REQUIRE_EQUAL (ui->text_draws, 1);
+        BOOST_REQUIRE_EQUAL (ui->idle_stats().skipped, 3u);
+
+        // invalidate once, draw once
+        ui->invalidate_idle_task (ui->text);
+        ui->invalidate_idle_task (ui->text);
+        for (uint64_t t = 1001; t <= 2000; ++t)
+            ui->run_idle_tasks (t * ms);
+        BOOST_REQUIRE_EQUAL (ui->text_draws, 2);
+        BOOST_REQUIRE_EQUAL (ui->meter_draws, 60);
+
+        // a stall doesn't cause a burst
+        ui->run_idle_tasks (10000 * ms);
+        ui->run_idle_tasks (10001 * ms);
+        BOOST_REQUIRE_EQUAL (ui->meter_draws, 61);
+        BOOST_REQUIRE_EQUAL (ui->next_idle_task_due (10001 * ms), 1000000000u / 30 - ms);
+
+        ui->set_idle_task_enabled (ui->meters, false);
+        ui->set_idle_task_rate (ui->text, 1.0);
+        ui->invalidate_idle_task (ui->text);
+        ui->run_idle_tasks (20000 * ms);
+        ui->invalidate_idle_task (ui->text);
+        ui->run_idle_tasks (20500 * ms);
+        BOOST_REQUIRE_EQUAL (ui->meter_draws, 61);
+        BOOST_REQUIRE_EQUAL (ui->text_draws, 3);
+        BOOST_REQUIRE_EQUAL (ui->next_idle_task_due (20500 * ms), 500 * ms);
+
+        desc.cleanup (ui);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+    void idle_interface() {
+        lvtk::UIDescriptor<IdleSchedulerUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+        auto ui          = instantiate (desc);
+        auto iface       = (const LV2UI_Idle_Interface*) desc.extension_data (LV2_UI__idleInterface);
+
+        for (int i = 0; i < 3; ++i)
+            BOOST_REQUIRE_EQUAL (iface->idle (ui), 0);
+        BOOST_REQUIRE_EQUAL (ui->idles, 3);
+        BOOST_REQUIRE_GE (ui->meter_draws, 1);
+        BOOST_REQUIRE_EQUAL (ui->text_draws, 1);
+
+        const auto& stats = ui->idle_stats();
+        BOOST_REQUIRE_EQUAL (stats.ticks, 3u);
+        BOOST_REQUIRE_GE (stats.runs, 2u);
+        BOOST_REQUIRE_GE (stats.elapsed_ns, stats.busy_ns);
+        BOOST_REQUIRE (stats.load() >= 0.0 && stats.load() <= 1.0);
+        ui->reset_idle_stats();
+        BOOST_REQUIRE_EQUAL (ui->idle_stats().ticks, 0u);
+
+        desc.cleanup (ui);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+    void add_from_task() {
+        lvtk::UIDescriptor<IdleSchedulerUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+        auto ui          = instantiate (desc);
+
+        // adding from a task moves the task list while it runs
+        int added = 0, spawns = 0;
+        ui->add_idle_task (1.0, [&] {
+            ++spawns;
+            for (int i = 0; i < 64; ++i)
+                ui->add_idle_task (1.0, [&added] { ++added; });
+        });
+
+        const uint64_t ms = 1000000;
+        BOOST_REQUIRE_EQUAL (ui->run_idle_tasks (1 * ms), 3u);
+        BOOST_REQUIRE_EQUAL (spawns, 1);
+        BOOST_REQUIRE_EQUAL (added, 0); // they wait for the next tick
+        BOOST_REQUIRE_EQUAL (ui->run_idle_tasks (2 * ms), 64u);
+        BOOST_REQUIRE_EQUAL (added, 64);
+
+        ui->run_idle_tasks (1001 * ms);
+        BOOST_REQUIRE_EQUAL (spawns, 2);
+
+        desc.cleanup (ui);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+private:
+    static IdleSchedulerUI* instantiate (const LV2UI_Descriptor& desc) {
+        const LV2_Feature* features[] = { nullptr };
+        LV2UI_Widget widget           = nullptr;
+        auto handle                   = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", nullptr, nullptr, &widget, features);
+        BOOST_REQUIRE (handle != nullptr);
+        return static_cast<IdleSchedulerUI*> (handle);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (IdleScheduler)
+
+BOOST_AUTO_TEST_CASE (rates) {
+    IdleSchedulerTest().rates();
+}
+
+BOOST_AUTO_TEST_CASE (idle_interface) {
+    IdleSchedulerTest().idle_interface();
+}
+
+BOOST_AUTO_TEST_CASE (add_from_task) {
+    IdleSchedulerTest().add_from_task();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,34 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "bench.hpp"
+
+#include <lvtk/dsp/kernels.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace lvtk::dsp;
+
+BENCH_SUITE (Kernels) {
+    const uint32_t nframes = 256;
+    std::vector<float> a (nframes * 2, 0.25f), b (nframes * 2, 0.5f), c (nframes * 2);
+    const float* planes[2] = { a.data(), b.data() };
+    float* outs[2]         = { a.data(), b.data() };
+
+    for (auto isa : { ISA::SCALAR, ISA::SSE2, ISA::AVX2, ISA::AVX512 }) {
+        const auto& k = kernels (isa);
+        if (k.isa != isa)
+            continue;
+
+        const std::string prefix = std::string (isa_name (isa)) + " ";
+        bench::measure (prefix + "gain", [&]() { k.gain (c.data(), a.data(), 0.7f, nframes); bench::keep (c[0]); });
+        bench::measure (prefix + "gain_ramp", [&]() { k.gain_ramp (c.data(), a.data(), 0.1f, 0.9f, nframes); bench::keep (c[0]); });
+        bench::measure (prefix + "mix_gain", [&]() { k.mix_gain (c.data(), a.data(), 0.7f, nframes); bench::keep (c[0]); });
+        bench::measure (prefix + "interleave", [&]() { k.interleave (c.data(), planes, 2, nframes); bench::keep (c[0]); });
+        bench::measure (prefix + "deinterleave", [&]() { k.deinterleave (outs, c.data(), 2, nframes); bench::keep (a[0]); });
+        bench::measure (prefix + "peak", [&]() { bench::keep (k.peak (a.data(), nframes)); });
+        bench::measure (prefix + "rms", [&]() { bench::keep (k.rms (a.data(), nframes)); });
+    }
+}
@@ -0,0 +1,136 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/dsp/kernels.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+using namespace lvtk::dsp;
+
+class KernelsTest {
+public:
+    KernelsTest() {
+        // odd sizes and offsets exercise the unaligned heads and tails
+        for (uint32_t i = 0; i < buffer_size; ++i)
+            input.push_back (std::sin ((float) i * 0.37f) * (i % 7 == 0 ? -1.5f : 0.8f));
+    }
+
+    void accuracy (ISA isa) {
+        const auto& ref = kernels (ISA::SCALAR);
+        const auto& k   = kernels (isa);
+        if (k.isa != isa) {
+            BOOST_TEST_MESSAGE ("skipping unsupported " << isa_name (isa));
+            return;
+        }
+
+        for (uint32_t n : { 0u, 1u, 3u, 4u, 7u, 8u, 15u, 16u, 17u, 33u, 64u, 127u, 1000u }) {
+            for (uint32_t offset : { 0u, 1u, 3u }) {
+                const float* src = input.data() + offset;
+
+                run_both (ref.gain, k.gain, src, 0.5f, n);
+                run_both (ref.gain_ramp, k.gain_ramp, src, 0.25f, 1.75f, n);
+                run_both (ref.mix, k.mix, src, n);
+                run_both (ref.mix_gain, k.mix_gain, src, -0.3f, n);
+                run_both (ref.copy, k.copy, src, n);
+
+                std::vector<float> a (n, 1.f);
+                k.clear (a.data(), n);
+                for (auto v : a)
+                    BOOST_REQUIRE_EQUAL (v, 0.f);
+
+                std::vector<float> b (n);
+                ref.ramp (a.data(), -0.5f, 2.f, n);
+                k.ramp (b.data(), -0.5f, 2.f, n);
+                for (uint32_t i = 0; i < n; ++i)
+                    BOOST_REQUIRE_CLOSE (a[i] + 10.f, b[i] + 10.f, 0.0001f);
+                k.fill (b.data(), 0.75f, n);
+                for (auto v : b)
+                    BOOST_REQUIRE_EQUAL (v, 0.75f);
+
+                BOOST_REQUIRE_EQUAL (ref.peak (src, n), k.peak (src, n));
+                BOOST_REQUIRE_CLOSE (ref.rms (src, n) + 1.f, k.rms (src, n) + 1.f, 0.001f);
+
+                check_interleave (ref, k, src, 2, n);
+                check_interleave (ref, k, src, 3, n);
+            }
+        }
+    }
+
+    void in_place() {
+        const auto& k = kernels();
+        std::vector<float> buf (input.begin(), input.begin() + 100);
+        k.gain (buf.data(), buf.data(), 2.f, (uint32_t) buf.size());
+        for (size_t i = 0; i < buf.size(); ++i)
+            BOOST_REQUIRE_EQUAL (buf[i], input[i] * 2.f);
+
+        // overlapping copy behaves like memmove
+        buf.assign (input.begin(), input.begin() + 100);
+        k.copy (buf.data() + 1, buf.data(), 99);
+        for (size_t i = 1; i < buf.size(); ++i)
+            BOOST_REQUIRE_EQUAL (buf[i], input[i - 1]);
+    }
+
+private:
+    enum : uint32_t { buffer_size = 1024 + 64 };
+    std::vector<float> input;
+
+    template <typename Fn, typename... Args>
+    void run_both (Fn ref, Fn fn, const float* src, Args... args) {
+        const uint32_t n = std::get<sizeof...(Args) - 1> (std::make_tuple (args...));
+        std::vector<float> a (input.rbegin(), input.rbegin() + n);
+        std::vector<float> b (a);
+        ref (a.data(), src, args...);
+        fn (b.data(), src, args...);
+        for (uint32_t i = 0; i < n; ++i)
+            BOOST_REQUIRE_CLOSE (a[i] + 10.f, b[i] + 10.f, 0.0001f);
+    }
+
+    void check_interleave (const Kernels& ref, const Kernels& k, const float* src, uint32_t channels, uint32_t n) {
+        std::vector<const float*> planes;
+        for (uint32_t c = 0; c < channels; ++c)
+            planes.push_back (src + c * 11);
+
+        std::vector<float> a (channels * n), b (channels * n);
+        ref.interleave (a.data(), planes.data(), channels, n);
+        k.interleave (b.data(), planes.data(), channels, n);
+        BOOST_REQUIRE (a == b);
+
+        std::vector<std::vector<float>> outs (channels, std::vector<float> (n));
+        std::vector<float*> outp;
+        for (auto& o : outs)
+            outp.push_back (o.data());
+        k.deinterleave (outp.data(), a.data(), channels, n);
+        for (uint32_t c = 0; c < channels; ++c)
+            for (uint32_t i = 0; i < n; ++i)
+                BOOST_REQUIRE_EQUAL (outs[c][i], planes[c][i]);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Kernels)
+
+BOOST_AUTO_TEST_CASE (scalar) {
+    KernelsTest().accuracy (ISA::SCALAR);
+}
+
+BOOST_AUTO_TEST_CASE (sse2) {
+    KernelsTest().accuracy (ISA::SSE2);
+}
+
+BOOST_AUTO_TEST_CASE (avx2) {
+    KernelsTest().accuracy (ISA::AVX2);
+}
+
+BOOST_AUTO_TEST_CASE (avx512) {
+    KernelsTest().accuracy (ISA::AVX512);
+}
+
+BOOST_AUTO_TEST_CASE (in_place) {
+    KernelsTest().in_place();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,7 @@
 #include <lv2/core/lv2.h>
 #include <lv2/log/log.h>
 #include <lv2/urid/urid.h>
+#include <lv2/worker/worker.h>
 
 #include <cstdio>
 #include <cstring>
@@ -25,6 +26,23 @@ struct LogPlug : lvtk::Plugin<LogPlug, lvtk::Log> {
     }
 };
 
+struct RtLogPlug : lvtk::Plugin<RtLogPlug, lvtk::Log, lvtk::Worker> {
+    RtLogPlug (const lvtk::Args& args) : Plugin (args) {
+        enable_rt_log (4);
+    }
+
+    void run (uint32_t nframes) {
+        rt_log().note ("run %u frames\n", nframes);
+    }
+
+    lvtk::WorkerStatus work (lvtk::WorkerRespond&, uint32_t, const void*) {
+        ++work_calls;
+        return LV2_WORKER_SUCCESS;
+    }
+
+    int work_calls = 0;
+};
+
 class LogTest {
 public:
     void integration() {
@@ -59,7 +77,125 @@ public:
         lvtk::descriptors().pop_back(); // needed so descriptor count test doesn't fail
     }
 
+    void deferred() {
+        lvtk::Symbols uris;
+        lvtk::Logger logger;
+        LV2_Log_Log log { this, _printf, _vprintf };
+        logger.set (lvtk::Feature (LV2_LOG__log, &log));
+        logger.init ((LV2_URID_Map*) uris.map_feature()->data);
+
+        lvtk::DeferredLogger rt;
+        rt.set_logger (&logger);
+        BOOST_REQUIRE (! rt.note ("no ring\n"));
+        BOOST_REQUIRE_EQUAL (rt.dropped(), 1u);
+
+        rt.reserve (3); // rounds up to 4
+        rt.set_rate_limit (0);
+        const char* name = "gain";
+        enum class Mode { A, B };
+        BOOST_REQUIRE (rt.error ("%s=%.2f dB (%d%%) %5u %x %c %ld %p\n",
+                                 name, -6.0f, -50, 42u, 255, 'z', 7L, nullptr));
+        BOOST_REQUIRE (rt.warning ("%lld %zu %d %s\n", (long long) -1, sizeof (int), Mode::B, (const char*) nullptr));
+        BOOST_REQUIRE (rt.trace ("missing %d %d\n", 1));
+        BOOST_REQUIRE (rt.note ("%d %f %u %x %llx\n", 2.5, 3, -1, -1, -1ll));
+        BOOST_REQUIRE (! rt.note ("full\n"));
+        BOOST_REQUIRE (rt.pending());
+        BOOST_REQUIRE (messages.empty());
+
+        BOOST_REQUIRE_EQUAL (rt.flush(), 4u);
+        BOOST_REQUIRE (! rt.pending());
+        BOOST_REQUIRE_EQUAL (messages.size(), 5u);
+        BOOST_REQUIRE_EQUAL (messages[0], "gain=-6.00 dB (-50%)    42 ff z 7 (nil)\n");
+        BOOST_REQUIRE_EQUAL (types[0], uris.map (LV2_LOG__Error));
+        BOOST_REQUIRE_EQUAL (messages[1], "-1 4 1 (null)\n");
+        BOOST_REQUIRE_EQUAL (types[1], uris.map (LV2_LOG__Warning));
+        BOOST_REQUIRE_EQUAL (messages[2], "missing 1 %d\n");
+        BOOST_REQUIRE_EQUAL (messages[3], "2 3.000000 4294967295 ffffffff ffffffffffffffff\n");
+        // the drop is reported once
+        BOOST_REQUIRE_EQUAL (messages[4], "lvtk: 2 log messages dropped, 0 rate limited\n");
+        BOOST_REQUIRE_EQUAL (types[4], uris.map (LV2_LOG__Warning));
+        BOOST_REQUIRE_EQUAL (rt.flush(), 0u);
+        BOOST_REQUIRE_EQUAL (messages.size(), 5u);
+
+        // wraps around the ring
+        for (int i = 0; i < 10; ++i) {
+            BOOST_REQUIRE (rt.note ("%d\n", i));
+            BOOST_REQUIRE_EQUAL (rt.flush(), 1u);
+            BOOST_REQUIRE_EQUAL (messages.back(), std::to_string (i) + "\n");
+        }
+    }
+
+    void rate_limit() {
+        lvtk::DeferredLogger rt;
+        rt.reserve (64);
+        rt.set_rate_limit (5);
+        uint32_t accepted = 0;
+        for (int i = 0; i < 50; ++i) {
+            accepted += rt.note ("a\n") ? 1 : 0;
+            rt.note ("b\n");
+        }
+        // at most two windows if the second ticks over
+        BOOST_REQUIRE_GE (accepted, 5u);
+        BOOST_REQUIRE_LE (accepted, 10u);
+        BOOST_REQUIRE_GE (rt.suppressed(), 80u);
+        BOOST_REQUIRE_EQUAL (rt.dropped(), 0u);
+    }
+
+    void worker_flush() {
+        lvtk::Descriptor<RtLogPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        lvtk::Symbols uris;
+        LV2_Log_Log log { this, _printf, _vprintf };
+        LV2_Feature flog { LV2_LOG__log, &log };
+        LV2_Worker_Schedule schedule { this, _schedule_work };
+        LV2_Feature fschedule { LV2_WORKER__schedule, &schedule };
+        const LV2_Feature* features[] = { uris.map_feature(), &flog, &fschedule, nullptr };
+
+        auto handle = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        auto plugin = static_cast<RtLogPlug*> (handle);
+        BOOST_REQUIRE (plugin != nullptr);
+        auto iface = (const LV2_Worker_Interface*) desc.extension_data (LV2_WORKER__interface);
+        BOOST_REQUIRE (iface != nullptr);
+
+        desc.run (handle, 64);
+        desc.run (handle, 32);
+        BOOST_REQUIRE (messages.empty());
+
+        iface->end_run (handle);
+        BOOST_REQUIRE_EQUAL (scheduled.size(), 1u);
+        iface->end_run (handle); // only one flush in flight
+        BOOST_REQUIRE_EQUAL (scheduled.size(), 1u);
+
+        iface->work (handle, nullptr, nullptr, (uint32_t) scheduled[0].size(), scheduled[0].data());
+        BOOST_REQUIRE_EQUAL (plugin->work_calls, 0);
+        BOOST_REQUIRE_EQUAL (messages.size(), 2u);
+        BOOST_REQUIRE_EQUAL (messages[0], "run 64 frames\n");
+        BOOST_REQUIRE_EQUAL (messages[1], "run 32 frames\n");
+        BOOST_REQUIRE_EQUAL (types[0], uris.map (LV2_LOG__Note));
+
+        // nothing pending, nothing scheduled.  other work still arrives
+        iface->end_run (handle);
+        BOOST_REQUIRE_EQUAL (scheduled.size(), 1u);
+        uint32_t job = 1;
+        iface->work (handle, nullptr, nullptr, sizeof (job), &job);
+        BOOST_REQUIRE_EQUAL (plugin->work_calls, 1);
+
+        desc.cleanup (handle);
+        lvtk::descriptors().pop_back();
+    }
+
 private:
+    std::vector<std::string> messages;
+    std::vector<LV2_URID> types;
+    std::vector<std::vector<char>> scheduled;
+
+    static LV2_Worker_Status _schedule_work (LV2_Worker_Schedule_Handle handle, uint32_t size, const void* data) {
+        auto bytes = static_cast<const char*> (data);
+        static_cast<LogTest*> (handle)->scheduled.emplace_back (bytes, bytes + size);
+        return LV2_WORKER_SUCCESS;
+    }
+
     enum { buffer_size = 256 };
     char buffer[buffer_size];
     LV2_URID msg_type = 0;
@@ -70,7 +206,10 @@ private:
         auto& buffer                             = static_cast<LogTest*> (handle)->buffer;
         static_cast<LogTest*> (handle)->msg_type = type;
         memset (buffer, 0, buffer_size);
-        return vsprintf (buffer, msg, args);
+        const int result = vsnprintf (buffer, buffer_size, msg, args);
+        static_cast<LogTest*> (handle)->messages.push_back (buffer);
+        static_cast<LogTest*> (handle)->types.push_back (type);
+        return result;
     }
 };
 
@@ -80,4 +219,16 @@ BOOST_AUTO_TEST_CASE (integration) {
     LogTest().integration();
 }
 
+BOOST_AUTO_TEST_CASE (deferred) {
+    LogTest().deferred();
+}
+
+BOOST_AUTO_TEST_CASE (rate_limit) {
+    LogTest().rate_limit();
+}
+
+BOOST_AUTO_TEST_CASE (worker_flush) {
+    LogTest().worker_flush();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
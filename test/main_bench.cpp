@@ -0,0 +1,31 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+// usage: bench [-t Suite]
+int main (int argc, char** argv) {
+    const char* only = nullptr;
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp (argv[i], "-t") == 0 && i + 1 < argc)
+            only = argv[++i];
+
+    int ran = 0;
+    for (const auto& suite : bench::suites()) {
+        if (only != nullptr && std::strcmp (only, suite.name) != 0)
+            continue;
+        std::printf ("%s\n", suite.name);
+        suite.run();
+        ++ran;
+    }
+
+    if (ran == 0 && only != nullptr) {
+        std::fprintf (stderr, "bench: no suite named '%s'\n", only);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "bench.hpp"
+
+#include <lvtk/dsp/math.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace lvtk::dsp;
+
+namespace {
+template <typename Fn>
+void run (const char* label, std::vector<float>& dst, const std::vector<float>& src, Fn fn) {
+    bench::measure (label, [&]() {
+        approx::transform (dst.data(), src.data(), (uint32_t) src.size(), fn);
+        bench::keep (dst[0]);
+    });
+}
+} // namespace
+
+BENCH_SUITE (Math) {
+    const uint32_t nframes = 256;
+    std::vector<float> db (nframes), gain (nframes), x (nframes), out (nframes);
+    for (uint32_t i = 0; i < nframes; ++i) {
+        db[i]   = -90.f + 100.f * (float) i / nframes;
+        gain[i] = 0.001f + (float) i / nframes;
+        x[i]    = -4.f + 8.f * (float) i / nframes;
+    }
+
+    run ("libm powf (10, db / 20)", out, db, [] (float v) { return std::pow (10.f, v * 0.05f); });
+    run ("db_to_gain LOW", out, db, [] (float v) { return approx::db_to_gain<Accuracy::LOW> (v); });
+    run ("db_to_gain MEDIUM", out, db, [] (float v) { return approx::db_to_gain<Accuracy::MEDIUM> (v); });
+    run ("db_to_gain HIGH", out, db, [] (float v) { return approx::db_to_gain<Accuracy::HIGH> (v); });
+
+    run ("libm log10f * 20", out, gain, [] (float v) { return 20.f * std::log10 (v); });
+    run ("gain_to_db MEDIUM", out, gain, [] (float v) { return approx::gain_to_db (v); });
+
+    run ("libm exp2f", out, x, [] (float v) { return std::exp2 (v); });
+    run ("exp2 MEDIUM", out, x, [] (float v) { return approx::exp2 (v); });
+
+    run ("libm tanhf", out, x, [] (float v) { return std::tanh (v); });
+    run ("tanh LOW", out, x, [] (float v) { return approx::tanh<Accuracy::LOW> (v); });
+    run ("tanh MEDIUM", out, x, [] (float v) { return approx::tanh (v); });
+
+    run ("libm sinf", out, x, [] (float v) { return std::sin (v); });
+    run ("sin MEDIUM", out, x, [] (float v) { return approx::sin (v); });
+    run ("sin HIGH", out, x, [] (float v) { return approx::sin<Accuracy::HIGH> (v); });
+
+    static constexpr LookupTable<1025> sine { [] (double v) { return cx::sin (v); }, -4.0, 4.0 };
+    run ("sin LookupTable<1025>", out, x, [] (float v) { return sine (v); });
+}
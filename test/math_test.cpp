@@ -0,0 +1,112 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/dsp/math.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace lvtk::dsp;
+
+namespace {
+constexpr LookupTable<1025> sine_table {
+    [] (double x) { return cx::sin (x); }, 0.0, 2.0 * cx::pi
+};
+static_assert (sine_table.size() == 1025, "table size");
+static_assert (sine_table[0] == 0.f, "sin (0)");
+static_assert (sine_table[256] > 0.99999f && sine_table[256] <= 1.f, "sin (pi/2)");
+} // namespace
+
+class MathTest {
+public:
+    template <Accuracy A>
+    void accuracy (double exp2_err, double log2_err, double tanh_err, double sin_err) {
+        double e2 = 0, l2 = 0, th = 0, sn = 0;
+        for (int i = 0; i <= 20000; ++i) {
+            const float x = -60.f + 120.f * i / 20000.f;
+            e2            = std::fmax (e2, std::fabs (approx::exp2<A> (x) / std::exp2 ((double) x) - 1.0));
+
+            const float g = std::exp2 (-40.f + 80.f * i / 20000.f);
+            l2            = std::fmax (l2, std::fabs (approx::log2<A> (g) - std::log2 ((double) g)));
+
+            const float t = -10.f + 20.f * i / 20000.f;
+            th            = std::fmax (th, std::fabs (approx::tanh<A> (t) - std::tanh ((double) t)));
+
+            const float s = (float) (-2.0 * M_PI + 4.0 * M_PI * i / 20000.0);
+            sn            = std::fmax (sn, std::fabs (approx::sin<A> (s) - std::sin ((double) s)));
+        }
+
+        BOOST_REQUIRE_LE (e2, exp2_err);
+        BOOST_REQUIRE_LE (l2, log2_err);
+        BOOST_REQUIRE_LE (th, tanh_err);
+        BOOST_REQUIRE_LE (sn, sin_err);
+    }
+
+    void conversions() {
+        BOOST_REQUIRE_CLOSE (approx::db_to_gain (0.f), 1.f, 0.001f);
+        BOOST_REQUIRE_CLOSE (approx::db_to_gain (-6.0206f), 0.5f, 0.001f);
+        BOOST_REQUIRE_CLOSE (approx::db_to_gain (20.f), 10.f, 0.001f);
+        BOOST_REQUIRE_CLOSE (approx::gain_to_db (10.f), 20.f, 0.001f);
+        BOOST_REQUIRE_CLOSE (approx::pow (3.f, 2.5f), std::pow (3.f, 2.5f), 0.001f);
+        BOOST_REQUIRE_CLOSE (approx::cos<Accuracy::HIGH> (1.f), std::cos (1.f), 0.0001f);
+
+        // exact at integer powers of two, saturates at the clamp
+        BOOST_REQUIRE_EQUAL (approx::exp2<Accuracy::HIGH> (10.f), 1024.f);
+        BOOST_REQUIRE_EQUAL (approx::log2<Accuracy::HIGH> (0.25f), -2.f);
+        BOOST_REQUIRE (std::isfinite (approx::exp2 (1000.f)));
+        BOOST_REQUIRE (approx::exp2 (-1000.f) > 0.f);
+        BOOST_REQUIRE_EQUAL (approx::tanh<Accuracy::LOW> (100.f), 1.f);
+    }
+
+    void transform() {
+        std::vector<float> db { -60.f, -6.f, 0.f, 3.f, 12.f }, gain (db.size());
+        approx::transform (gain.data(), db.data(), (uint32_t) db.size(), [] (float x) {
+            return approx::db_to_gain<Accuracy::HIGH> (x);
+        });
+        for (size_t i = 0; i < db.size(); ++i)
+            BOOST_REQUIRE_CLOSE (gain[i], std::pow (10.f, db[i] / 20.f), 0.0001f);
+    }
+
+    void lookup_table() {
+        for (int i = 0; i <= 1000; ++i) {
+            const float x = (float) (2.0 * M_PI * i / 1000.0);
+            BOOST_REQUIRE_SMALL (sine_table (x) - std::sin (x), 5.0e-6f);
+        }
+        // clamped at both ends
+        BOOST_REQUIRE_EQUAL (sine_table (-1.f), sine_table[0]);
+        BOOST_REQUIRE_EQUAL (sine_table (100.f), sine_table[1024]);
+
+        constexpr LookupTable<2> line { [] (double x) { return 2.0 * x; }, 0.0, 1.0 };
+        BOOST_REQUIRE_EQUAL (line (0.25f), 0.5f);
+
+        BOOST_REQUIRE_CLOSE (cx::exp (1.0), std::exp (1.0), 1.0e-10);
+        BOOST_REQUIRE_CLOSE (cx::log (10.0), std::log (10.0), 1.0e-10);
+        BOOST_REQUIRE_CLOSE (cx::tanh (0.5), std::tanh (0.5), 1.0e-10);
+        BOOST_REQUIRE_CLOSE (cx::db_to_gain (-6.0), std::pow (10.0, -0.3), 1.0e-10);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Math)
+
+BOOST_AUTO_TEST_CASE (accuracy) {
+    MathTest t;
+    t.accuracy<Accuracy::LOW> (1.2e-4, 1.5e-5, 2.5e-2, 1.5e-4);
+    t.accuracy<Accuracy::MEDIUM> (4.0e-6, 3.0e-7, 2.0e-6, 1.5e-6);
+    t.accuracy<Accuracy::HIGH> (1.5e-7, 1.5e-7, 2.0e-7, 6.0e-7);
+}
+
+BOOST_AUTO_TEST_CASE (conversions) {
+    MathTest().conversions();
+}
+
+BOOST_AUTO_TEST_CASE (transform) {
+    MathTest().transform();
+}
+
+BOOST_AUTO_TEST_CASE (lookup_table) {
+    MathTest().lookup_table();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
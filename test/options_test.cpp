@@ -5,11 +5,61 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "lvtk/ext/bufsize.hpp"
+#include "lvtk/ext/idle.hpp"
 #include "lvtk/options.hpp"
+#include "lvtk/plugin.hpp"
 #include "lvtk/symbols.hpp"
+#include "lvtk/ui.hpp"
+
+#include <lv2/atom/atom.h>
 
 #include <cstdint>
 
+struct RuntimeOptionsPlug : lvtk::Plugin<RuntimeOptionsPlug, lvtk::Options> {
+    RuntimeOptionsPlug (const lvtk::Args& args) : Plugin (args) {
+        block = watch_option (LV2_BUF_SIZE__nominalBlockLength);
+        rate  = watch_option ("http://lv2plug.in/ns/ext/parameters#sampleRate");
+        // values passed at instantiation are there right away
+        nominal = option_value<uint32_t> (block, 0);
+    }
+
+    void options_changed() {
+        ++changes;
+        if (option_changed (block))
+            nominal = option_value<uint32_t> (block, nominal);
+        if (option_changed (rate))
+            sample_rate = option_value<double> (rate);
+    }
+
+    void run (uint32_t) { ++runs; }
+
+    int block = -1, rate = -1;
+    uint32_t nominal   = 0;
+    double sample_rate = 0.0;
+    int changes = 0, runs = 0;
+};
+
+struct RuntimeOptionsUI : lvtk::UI<RuntimeOptionsUI, lvtk::Options, lvtk::Idle> {
+    RuntimeOptionsUI (const lvtk::UIArgs& args) : UI (args) {
+        scale = watch_option (LV2_UI__scaleFactor);
+    }
+
+    void options_changed() {
+        if (option_changed (scale))
+            scale_factor = option_value<float> (scale, scale_factor);
+    }
+
+    int idle() {
+        idle_scale = scale_factor;
+        return 0;
+    }
+
+    int scale          = -1;
+    float scale_factor = 1.f;
+    float idle_scale   = 0.f;
+};
+
 class OptionsTest {
 protected:
     lvtk::Symbols urids;
@@ -49,6 +99,139 @@ public:
         for (const auto& opt : opts_ref) // check values are same
             BOOST_REQUIRE_EQUAL (1024, (int) *(uint32_t*) opt.value);
     }
+
+    void owned_values() {
+        const auto subject = urids.map ("http://lvtoolkit.org/ns/lvtk#TestSubject");
+        const auto key     = urids.map ("http://lv2plug.in/ns/ext/buf-size/buf-size.html#maxBlockLength");
+        const auto type    = urids.map ("http://www.w3.org/2001/XMLSchema#nonNegativeInteger");
+
+        // grows past the inline storage, values must follow the options
+        lvtk::OptionArray opts;
+        for (uint32_t i = 0; i < 100; ++i)
+            opts.add_value (LV2_OPTIONS_INSTANCE, subject, key, type, i);
+        BOOST_REQUIRE_EQUAL (opts.size(), 100);
+        BOOST_REQUIRE_EQUAL (opts.get()[100].key, 0);
+        check_values (opts, 100);
+
+        // copies don't point at the original's values
+        lvtk::OptionArray copy (opts);
+        opts = lvtk::OptionArray();
+        BOOST_REQUIRE (opts.empty());
+        check_values (copy, 100);
+
+        // reserve allocates once, up front
+        lvtk::OptionArray sized;
+        sized.reserve (10, 10 * 8);
+        const auto data = sized.get();
+        for (uint32_t i = 0; i < 10; ++i)
+            sized.add_value (LV2_OPTIONS_INSTANCE, subject, key, type, i);
+        BOOST_REQUIRE_EQUAL (sized.get(), data);
+        BOOST_REQUIRE_EQUAL (sized.options_capacity(), 10);
+        check_values (sized, 10);
+
+        // small arrays stay inline and survive a move
+        lvtk::OptionArray small;
+        uint32_t borrowed = 7;
+        small.add_value (LV2_OPTIONS_INSTANCE, subject, key, type, uint32_t (0));
+        small.add (LV2_OPTIONS_INSTANCE, subject, key, sizeof (uint32_t), type, &borrowed);
+        lvtk::OptionArray moved (std::move (small));
+        BOOST_REQUIRE (small.empty());
+        BOOST_REQUIRE_EQUAL (moved.size(), 2);
+        BOOST_REQUIRE_EQUAL (*(const uint32_t*) moved.get()[0].value, 0);
+        BOOST_REQUIRE_EQUAL (moved.get()[1].value, &borrowed);
+    }
+
+    void runtime() {
+        const auto subject = urids.map (LVTK_TEST_PLUGIN_URI);
+        const auto nominal = urids.map (LV2_BUF_SIZE__nominalBlockLength);
+        const auto rate    = urids.map ("http://lv2plug.in/ns/ext/parameters#sampleRate");
+        const auto atom_int   = urids.map (LV2_ATOM__Int);
+        const auto atom_float = urids.map (LV2_ATOM__Float);
+
+        lvtk::OptionArray initial;
+        initial.add_value (LV2_OPTIONS_INSTANCE, subject, nominal, atom_int, int32_t (256));
+        LV2_Feature options_feature   = { LV2_OPTIONS__options, const_cast<lvtk::Option*> (initial.get()) };
+        const LV2_Feature* features[] = { urids.map_feature(), &options_feature, nullptr };
+
+        lvtk::Descriptor<RuntimeOptionsPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+        auto handle      = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        auto plugin      = static_cast<RuntimeOptionsPlug*> (handle);
+        BOOST_REQUIRE (plugin != nullptr);
+        BOOST_REQUIRE (plugin->block >= 0 && plugin->rate >= 0);
+        BOOST_REQUIRE_EQUAL (plugin->nominal, 256u);
+        BOOST_REQUIRE (! plugin->option_available (plugin->rate));
+
+        auto iface = static_cast<const LV2_Options_Interface*> (desc.extension_data (LV2_OPTIONS__interface));
+        BOOST_REQUIRE (iface != nullptr);
+
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->changes, 0);
+
+        // staged by set(), applied before the next run
+        lvtk::OptionArray update;
+        update.add_value (LV2_OPTIONS_INSTANCE, subject, nominal, atom_int, int32_t (512))
+            .add_value (LV2_OPTIONS_INSTANCE, subject, rate, atom_float, 48000.f)
+            .add_value (LV2_OPTIONS_INSTANCE, subject, urids.map ("http://lvtoolkit.org/ns/lvtk#Unwatched"), atom_int, int32_t (1));
+        BOOST_REQUIRE_EQUAL (iface->set (handle, update.get()), (uint32_t) LV2_OPTIONS_SUCCESS);
+        BOOST_REQUIRE_EQUAL (plugin->nominal, 256u);
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->changes, 1);
+        BOOST_REQUIRE_EQUAL (plugin->nominal, 512u);
+        BOOST_REQUIRE_EQUAL (plugin->sample_rate, 48000.0);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 2);
+
+        // only the changed slot is flagged
+        lvtk::OptionArray rate_only;
+        rate_only.add_value (LV2_OPTIONS_INSTANCE, subject, rate, atom_float, 96000.f);
+        iface->set (handle, rate_only.get());
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->changes, 2);
+        BOOST_REQUIRE (plugin->option_changed (plugin->rate));
+        BOOST_REQUIRE (! plugin->option_changed (plugin->block));
+        BOOST_REQUIRE_EQUAL (plugin->sample_rate, 96000.0);
+
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->changes, 2);
+        desc.cleanup (handle);
+    }
+
+    void ui_runtime() {
+        lvtk::UIDescriptor<RuntimeOptionsUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        const LV2_Feature* features[] = { urids.map_feature(), nullptr };
+        LV2UI_Widget widget           = nullptr;
+        auto handle                   = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", nullptr, nullptr, &widget, features);
+        BOOST_REQUIRE (handle != nullptr);
+        auto ui = static_cast<RuntimeOptionsUI*> (handle);
+        BOOST_REQUIRE (ui->scale >= 0);
+
+        auto options = (const LV2_Options_Interface*) desc.extension_data (LV2_OPTIONS__interface);
+        auto idle    = (const LV2UI_Idle_Interface*) desc.extension_data (LV2_UI__idleInterface);
+        BOOST_REQUIRE (options != nullptr && idle != nullptr);
+
+        // staged by set(), published before the next idle()
+        lvtk::OptionArray update;
+        update.add_value (LV2_OPTIONS_INSTANCE, 0, urids.map (LV2_UI__scaleFactor), urids.map (LV2_ATOM__Float), 2.f);
+        options->set (handle, update.get());
+        BOOST_REQUIRE_EQUAL (ui->scale_factor, 1.f);
+        idle->idle (handle);
+        BOOST_REQUIRE_EQUAL (ui->idle_scale, 2.f);
+
+        desc.cleanup (handle);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+private:
+    static void check_values (const lvtk::OptionArray& opts, uint32_t num) {
+        BOOST_REQUIRE_EQUAL (opts.size(), num);
+        uint32_t i = 0;
+        for (const auto& opt : opts) {
+            BOOST_REQUIRE_EQUAL (opt.size, sizeof (uint32_t));
+            BOOST_REQUIRE_EQUAL (*(const uint32_t*) opt.value, i++);
+        }
+    }
 };
 
 BOOST_AUTO_TEST_SUITE (Options)
@@ -57,6 +240,18 @@ BOOST_AUTO_TEST_CASE (array) {
     OptionsTest().array();
 }
 
+BOOST_AUTO_TEST_CASE (owned_values) {
+    OptionsTest().owned_values();
+}
+
+BOOST_AUTO_TEST_CASE (runtime) {
+    OptionsTest().runtime();
+}
+
+BOOST_AUTO_TEST_CASE (ui_runtime) {
+    OptionsTest().ui_runtime();
+}
+
 BOOST_AUTO_TEST_CASE (nullref) {
     lvtk::OptionArray array ((const lvtk::Option*) nullptr);
     BOOST_REQUIRE_EQUAL (array.size(), 0);
@@ -0,0 +1,167 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/worker.hpp>
+#include <lvtk/parameter_block.hpp>
+#include <lvtk/plugin.hpp>
+
+#include <lv2/worker/worker.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+struct Band {
+    float freq, gain, q;
+    uint32_t serial;
+};
+} // namespace
+
+// worker computes a band, run() reads it
+struct ParameterBlockPlug : lvtk::Plugin<ParameterBlockPlug, lvtk::Worker> {
+    ParameterBlockPlug (const lvtk::Args& args) : Plugin (args) {}
+
+    lvtk::WorkerStatus work (lvtk::WorkerRespond&, uint32_t size, const void* data) {
+        if (size != sizeof (float))
+            return LV2_WORKER_ERR_UNKNOWN;
+        const float freq = *static_cast<const float*> (data);
+        band.write ({ freq, 0.5f, freq / 1000.f, 1 });
+        return LV2_WORKER_SUCCESS;
+    }
+
+    void run (uint32_t) { current = band.read(); }
+
+    lvtk::ParameterBlock<Band> band { { 100.f, 0.f, 1.f, 0 } };
+    Band current {};
+};
+
+class ParameterBlockTest {
+public:
+    void basics() {
+        lvtk::ParameterBlock<Band> block;
+        BOOST_REQUIRE_EQUAL (block.read().freq, 0.f);
+        BOOST_REQUIRE_EQUAL (block.version(), 0u);
+
+        block.write ({ 1000.f, -3.f, 0.7f, 1 });
+        const Band& b = block.read();
+        BOOST_REQUIRE_EQUAL (b.freq, 1000.f);
+        BOOST_REQUIRE_EQUAL (b.gain, -3.f);
+        BOOST_REQUIRE_EQUAL (b.q, 0.7f);
+        BOOST_REQUIRE_EQUAL (block.version(), 1u);
+
+        block.modify ([] (Band& band) { band.gain = 6.f; });
+        BOOST_REQUIRE_EQUAL (block.read().gain, 6.f);
+        BOOST_REQUIRE_EQUAL (block.read().freq, 1000.f);
+        BOOST_REQUIRE_EQUAL (block.version(), 2u);
+
+        Band copy {};
+        BOOST_REQUIRE (block.try_read (copy));
+        BOOST_REQUIRE_EQUAL (copy.gain, 6.f);
+        BOOST_REQUIRE_EQUAL (block.fallbacks(), 0u);
+    }
+
+    void fallback() {
+        lvtk::ParameterBlock<Band, 2> block ({ 1.f, 2.f, 3.f, 0 });
+        block.read();
+
+        // a write is in progress while modify's callback runs
+        Band seen {};
+        bool fresh = true;
+        block.modify ([&] (Band& b) {
+            b.freq = 99.f;
+            fresh  = block.try_read (seen);
+            seen   = block.read();
+        });
+        BOOST_REQUIRE (! fresh);
+        BOOST_REQUIRE_EQUAL (seen.freq, 1.f);
+        BOOST_REQUIRE_EQUAL (block.fallbacks(), 1u);
+        BOOST_REQUIRE_EQUAL (block.read().freq, 99.f);
+    }
+
+    void concurrent() {
+        lvtk::ParameterBlock<Band> block;
+        constexpr uint32_t per_writer = 20000;
+        std::atomic<int> writing { 2 };
+
+        std::vector<std::thread> writers;
+        for (int w = 0; w < 2; ++w)
+            writers.emplace_back ([&, w] {
+                for (uint32_t i = 1; i <= per_writer; ++i) {
+                    const float v = (float) (i * 2 + (uint32_t) w);
+                    if (i % 2)
+                        block.write ({ v, v, v, i });
+                    else
+                        block.modify ([v, i] (Band& b) { b = { v, v, v, i }; });
+                }
+                --writing;
+            });
+
+        uint32_t torn = 0, reads = 0;
+        do {
+            const Band& b = block.read();
+            if (b.freq != b.gain || b.gain != b.q)
+                ++torn;
+            ++reads;
+        } while (writing.load() > 0);
+        for (auto& t : writers)
+            t.join();
+
+        BOOST_REQUIRE_EQUAL (torn, 0u);
+        BOOST_REQUIRE_GT (reads, 0u);
+        block.read();
+        BOOST_REQUIRE_EQUAL (block.version(), per_writer * 2);
+    }
+
+    void worker() {
+        lvtk::Descriptor<ParameterBlockPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        const LV2_Feature* features[] = { nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        BOOST_REQUIRE (handle != nullptr);
+        auto plugin = static_cast<ParameterBlockPlug*> (handle);
+
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->current.freq, 100.f);
+
+        auto iface = (const LV2_Worker_Interface*) desc.extension_data (LV2_WORKER__interface);
+        float freq = 2000.f;
+        std::thread worker ([&] {
+            BOOST_CHECK_EQUAL (iface->work (handle, nullptr, nullptr, sizeof (freq), &freq), LV2_WORKER_SUCCESS);
+        });
+        worker.join();
+
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->current.freq, 2000.f);
+        BOOST_REQUIRE_EQUAL (plugin->current.q, 2.f);
+        BOOST_REQUIRE_EQUAL (plugin->current.serial, 1u);
+
+        desc.cleanup (handle);
+        lvtk::descriptors().pop_back();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (ParameterBlock)
+
+BOOST_AUTO_TEST_CASE (basics) {
+    ParameterBlockTest().basics();
+}
+
+BOOST_AUTO_TEST_CASE (fallback) {
+    ParameterBlockTest().fallback();
+}
+
+BOOST_AUTO_TEST_CASE (concurrent) {
+    ParameterBlockTest().concurrent();
+}
+
+BOOST_AUTO_TEST_CASE (worker) {
+    ParameterBlockTest().worker();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
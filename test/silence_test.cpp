@@ -0,0 +1,183 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/silence.hpp>
+#include <lvtk/symbols.hpp>
+
+#include <vector>
+
+struct SilentPlug : lvtk::Plugin<SilentPlug, lvtk::SilenceBypass> {
+    SilentPlug (const lvtk::Args& args) : Plugin (args) {
+        watch_port (0, lvtk::SilencePort::AUDIO_IN);
+        watch_port (1, lvtk::SilencePort::AUDIO_OUT);
+        watch_port (2, lvtk::SilencePort::CONTROL_IN);
+        watch_port (3, lvtk::SilencePort::ATOM_IN);
+        set_silence_tail (128);
+    }
+
+    void connect_port (uint32_t port, void* data) {
+        if (port == 1)
+            output = (float*) data;
+    }
+
+    void run (uint32_t nframes) {
+        ++runs;
+        for (uint32_t i = 0; i < nframes; ++i)
+            output[i] = 1.f;
+    }
+
+    float* output = nullptr;
+    int runs      = 0;
+};
+
+struct NotifyPlug : lvtk::Plugin<NotifyPlug, lvtk::SilenceBypass> {
+    NotifyPlug (const lvtk::Args& args) : Plugin (args) {
+        watch_port (0, lvtk::SilencePort::AUDIO_IN);
+        watch_port (1, lvtk::SilencePort::ATOM_OUT);
+    }
+
+    void connect_port (uint32_t, void*) {}
+    void run (uint32_t) { ++runs; }
+
+    int runs = 0;
+};
+
+class SilenceTest {
+public:
+    void bypass() {
+        lvtk::Descriptor<SilentPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        const LV2_Feature* features[] = { nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        auto plugin                   = static_cast<SilentPlug*> (handle);
+        BOOST_REQUIRE (plugin != nullptr);
+
+        std::vector<float> input (64, 0.f), output (64, 0.f);
+        float control = 0.5f;
+        LV2_Atom_Sequence atoms;
+        atoms.atom.type = 0;
+        atoms.atom.size = sizeof (LV2_Atom_Sequence_Body);
+        atoms.body.unit = 0;
+        atoms.body.pad  = 0;
+
+        desc.connect_port (handle, 0, input.data());
+        desc.connect_port (handle, 1, output.data());
+        desc.connect_port (handle, 2, &control);
+        desc.connect_port (handle, 3, &atoms);
+        desc.activate (handle);
+
+        // tail rings out before bypassing
+        desc.run (handle, 64);
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 2);
+        BOOST_REQUIRE (! plugin->silence_bypassed());
+
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 2);
+        BOOST_REQUIRE (plugin->silence_bypassed());
+        for (auto v : output)
+            BOOST_REQUIRE_EQUAL (v, 0.f);
+
+        // below threshold noise stays bypassed
+        input[10] = 1.0e-7f;
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 2);
+        BOOST_REQUIRE_EQUAL (plugin->silence_bypassed_blocks(), 2u);
+
+        // control change resumes immediately, then the tail starts again
+        control = 0.75f;
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 3);
+        BOOST_REQUIRE_EQUAL (output[0], 1.f);
+        desc.run (handle, 64);
+        desc.run (handle, 64);
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 5);
+
+        // signal in the very last frame
+        input[63] = 0.1f;
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 6);
+        input[63] = 0.f;
+
+        // events resume too
+        desc.run (handle, 64);
+        desc.run (handle, 64);
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 8);
+        atoms.atom.size += 16;
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 9);
+
+        // infinite tail never bypasses
+        atoms.atom.size = sizeof (LV2_Atom_Sequence_Body);
+        plugin->set_silence_tail (UINT32_MAX);
+        desc.activate (handle);
+        for (int i = 0; i < 8; ++i)
+            desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 17);
+        BOOST_REQUIRE_EQUAL (plugin->silence_bypassed_blocks(), 0u);
+
+        desc.cleanup (handle);
+        lvtk::descriptors().pop_back();
+    }
+
+    void atom_out() {
+        lvtk::Descriptor<NotifyPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+        lvtk::Symbols symbols;
+
+        std::vector<float> input (64, 0.f);
+        alignas (8) uint8_t buffer[256];
+        auto notify = reinterpret_cast<LV2_Atom_Sequence*> (buffer);
+
+        // without a URID map there is no way to write the sequence
+        const LV2_Feature* no_map[] = { nullptr };
+        auto handle                 = desc.instantiate (&desc, 44100.0, "/fake/path", no_map);
+        auto plugin                 = static_cast<NotifyPlug*> (handle);
+        desc.connect_port (handle, 0, input.data());
+        desc.connect_port (handle, 1, buffer);
+        desc.activate (handle);
+        desc.run (handle, 64);
+        BOOST_REQUIRE_EQUAL (plugin->runs, 1);
+        BOOST_REQUIRE (! plugin->silence_bypassed());
+        desc.cleanup (handle);
+
+        const LV2_Feature* features[] = { symbols.map_feature(), nullptr };
+        handle                        = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        plugin                        = static_cast<NotifyPlug*> (handle);
+        desc.connect_port (handle, 0, input.data());
+        desc.connect_port (handle, 1, buffer);
+        desc.activate (handle);
+
+        // the host hands over the capacity, bypassing leaves it empty
+        notify->atom.type = symbols.map (LV2_ATOM__Chunk);
+        notify->atom.size = sizeof (buffer) - sizeof (LV2_Atom);
+        desc.run (handle, 64);
+        BOOST_REQUIRE (plugin->silence_bypassed());
+        BOOST_REQUIRE_EQUAL (plugin->runs, 0);
+        BOOST_REQUIRE_EQUAL (notify->atom.type, symbols.map (LV2_ATOM__Sequence));
+        BOOST_REQUIRE_EQUAL (notify->atom.size, sizeof (LV2_Atom_Sequence_Body));
+        BOOST_REQUIRE_EQUAL (notify->body.unit, 0u);
+
+        desc.cleanup (handle);
+        lvtk::descriptors().pop_back();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Silence)
+
+BOOST_AUTO_TEST_CASE (bypass) {
+    SilenceTest().bypass();
+}
+
+BOOST_AUTO_TEST_CASE (atom_out) {
+    SilenceTest().atom_out();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
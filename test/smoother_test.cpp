@@ -0,0 +1,168 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/dsp/smoother.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace lvtk::dsp;
+
+class SmootherTest {
+public:
+    void linear() {
+        Smoother s;
+        s.prepare (1000.0, 0.01, 4); // 10 frames
+        s.reset (0.f);
+        BOOST_REQUIRE (s.settled());
+
+        s.set_target (1.f);
+        BOOST_REQUIRE (! s.settled());
+
+        std::vector<float> buf (16);
+        s.render (k, buf.data(), 16);
+        for (int i = 0; i < 10; ++i)
+            BOOST_REQUIRE_CLOSE (buf[i] + 1.f, 0.1f * i + 1.f, 0.001f);
+        for (int i = 10; i < 16; ++i)
+            BOOST_REQUIRE_EQUAL (buf[i], 1.f);
+        BOOST_REQUIRE (s.settled());
+        BOOST_REQUIRE_EQUAL (s.current(), 1.f);
+    }
+
+    void exponential() {
+        Smoother s (SmoothingType::EXPONENTIAL);
+        s.prepare (1000.0, 0.008); // 8 frames, per frame
+        s.reset (1.f);
+        s.set_target (256.f);
+        for (int i = 0; i < 8; ++i)
+            BOOST_REQUIRE_CLOSE (s.next(), std::pow (2.f, (float) i), 0.001f);
+        BOOST_REQUIRE (s.settled());
+        BOOST_REQUIRE_EQUAL (s.next(), 256.f);
+
+        // zero crossing falls back to a linear ramp
+        s.set_target (0.f);
+        s.skip (4);
+        BOOST_REQUIRE_CLOSE (s.current(), 128.f, 0.001f);
+        s.skip (100);
+        BOOST_REQUIRE (s.settled());
+        BOOST_REQUIRE_EQUAL (s.current(), 0.f);
+    }
+
+    void one_pole() {
+        const double rate = 48000.0;
+        Smoother exact (SmoothingType::ONE_POLE);
+        Smoother blocked (SmoothingType::ONE_POLE);
+        exact.prepare (rate, 0.01);
+        blocked.prepare (rate, 0.01, 16);
+
+        exact.set_target (1.f);
+        blocked.set_target (1.f);
+
+        // one time constant in, both reach 63%, sub-blocks meet the exact curve
+        std::vector<float> a (480), b (480);
+        exact.render (k, a.data(), 480);
+        blocked.render (k, b.data(), 480);
+        BOOST_REQUIRE_CLOSE (exact.current(), 1.f - std::exp (-1.f), 0.01f);
+        for (uint32_t i = 0; i < 480; i += 16)
+            BOOST_REQUIRE_CLOSE (a[i], b[i], 0.01f);
+
+        exact.skip (48000);
+        BOOST_REQUIRE (exact.settled());
+        BOOST_REQUIRE_EQUAL (exact.current(), 1.f);
+    }
+
+    void settled_fast_path() {
+        Smoother s;
+        s.prepare (48000.0, 0.001, 16);
+        s.reset (0.5f);
+
+        std::vector<float> in (256, 2.f), out (256);
+        s.apply (k, out.data(), in.data(), 256);
+        for (auto v : out)
+            BOOST_REQUIRE_EQUAL (v, 1.f);
+
+        // ramp finishes inside the block, rest is constant and continuous
+        s.set_target (1.f);
+        s.apply (k, out.data(), in.data(), 256);
+        for (uint32_t i = 1; i < 256; ++i)
+            BOOST_REQUIRE (out[i] >= out[i - 1]);
+        BOOST_REQUIRE_EQUAL (out[255], 2.f);
+        BOOST_REQUIRE (s.settled());
+    }
+
+    void control_port() {
+        float port = -6.f;
+        int calls  = 0;
+        static int* counter;
+        counter = &calls;
+
+        ControlSmoother s;
+        s.prepare (1000.0, 0.01);
+        s.set_transform ([] (float db) {
+            ++*counter;
+            return std::pow (10.f, db * 0.05f);
+        });
+        s.connect (&port);
+        s.snap();
+        BOOST_REQUIRE (s.settled());
+        BOOST_REQUIRE_CLOSE (s.current(), 0.501187f, 0.001f);
+
+        BOOST_REQUIRE (! s.update());
+        BOOST_REQUIRE (! s.update());
+        BOOST_REQUIRE_EQUAL (calls, 1);
+
+        port = 0.f;
+        BOOST_REQUIRE (s.update());
+        BOOST_REQUIRE_EQUAL (calls, 2);
+        BOOST_REQUIRE_EQUAL (s.target(), 1.f);
+        s.skip (10);
+        BOOST_REQUIRE (! s.update());
+        BOOST_REQUIRE_EQUAL (calls, 2);
+    }
+
+    void stereo() {
+        Smoother s (SmoothingType::ONE_POLE);
+        s.prepare (48000.0, 0.005, 16);
+        s.set_target (1.f);
+
+        std::vector<float> l (200, 1.f), r (200, -1.f);
+        float* dst[]       = { l.data(), r.data() };
+        const float* src[] = { l.data(), r.data() };
+        s.apply (k, dst, src, 2, 200);
+        for (uint32_t i = 0; i < 200; ++i)
+            BOOST_REQUIRE_EQUAL (l[i], -r[i]);
+    }
+
+private:
+    const Kernels& k = kernels();
+};
+
+BOOST_AUTO_TEST_SUITE (Smoother)
+
+BOOST_AUTO_TEST_CASE (linear) {
+    SmootherTest().linear();
+}
+
+BOOST_AUTO_TEST_CASE (exponential) {
+    SmootherTest().exponential();
+}
+
+BOOST_AUTO_TEST_CASE (one_pole) {
+    SmootherTest().one_pole();
+}
+
+BOOST_AUTO_TEST_CASE (settled_fast_path) {
+    SmootherTest().settled_fast_path();
+}
+
+BOOST_AUTO_TEST_CASE (control_port) {
+    SmootherTest().control_port();
+}
+
+BOOST_AUTO_TEST_CASE (stereo) {
+    SmootherTest().stereo();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,171 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/snapshot.hpp>
+#include <lvtk/plugin.hpp>
+#include <lvtk/triple_buffer.hpp>
+#include <lvtk/ui.hpp>
+
+#include <lv2/data-access/data-access.h>
+#include <lv2/instance-access/instance-access.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+struct SnapshotMeters {
+    uint64_t block;
+    float peak[15];
+};
+
+struct SnapshotPlug : lvtk::Plugin<SnapshotPlug, lvtk::Snapshots> {
+    SnapshotPlug (const lvtk::Args& args) : Plugin (args) {
+        set_snapshot_buffer (meters);
+    }
+
+    void run (uint32_t nframes) {
+        auto& m = meters.write_buffer();
+        m.block = ++block;
+        for (auto& p : m.peak)
+            p = (float) nframes;
+        meters.publish();
+    }
+
+    uint64_t block = 0;
+    lvtk::TripleBuffer<SnapshotMeters> meters;
+};
+
+struct SnapshotUI : lvtk::UI<SnapshotUI, lvtk::SnapshotAccess> {
+    SnapshotUI (const lvtk::UIArgs& args) : UI (args) {}
+};
+
+class SnapshotTest {
+public:
+    void triple_buffer() {
+        lvtk::TripleBuffer<int> tb (-1);
+        BOOST_REQUIRE (! tb.update());
+        BOOST_REQUIRE_EQUAL (tb.read_buffer(), -1);
+
+        tb.write (1);
+        tb.write (2);
+        BOOST_REQUIRE (tb.update());
+        BOOST_REQUIRE_EQUAL (tb.read_buffer(), 2);
+        BOOST_REQUIRE (! tb.update());
+        BOOST_REQUIRE_EQUAL (tb.read_buffer(), 2);
+
+        for (int i = 3; i < 20; ++i) {
+            tb.write_buffer() = i;
+            tb.publish();
+            BOOST_REQUIRE_EQUAL (tb.read(), i);
+        }
+    }
+
+    void no_torn_reads() {
+        struct Block {
+            uint64_t values[16];
+        };
+        lvtk::TripleBuffer<Block> tb;
+        constexpr uint64_t total = 200000;
+        std::atomic<bool> done { false };
+
+        std::thread writer ([&] {
+            for (uint64_t i = 1; i <= total; ++i) {
+                auto& b = tb.write_buffer();
+                for (auto& v : b.values)
+                    v = i;
+                tb.publish();
+            }
+            done.store (true);
+        });
+
+        uint64_t last = 0, torn = 0, backwards = 0;
+        while (! done.load() || tb.update()) {
+            if (! tb.update())
+                continue;
+            const auto& b = tb.read_buffer();
+            for (auto v : b.values)
+                if (v != b.values[0])
+                    ++torn;
+            if (b.values[0] < last)
+                ++backwards;
+            last = b.values[0];
+        }
+        writer.join();
+        tb.update();
+
+        BOOST_REQUIRE_EQUAL (torn, 0u);
+        BOOST_REQUIRE_EQUAL (backwards, 0u);
+        BOOST_REQUIRE_EQUAL (tb.read_buffer().values[0], total);
+    }
+
+    void plugin_to_ui() {
+        lvtk::Descriptor<SnapshotPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+        BOOST_REQUIRE (desc.extension_data (LVTK_SNAPSHOT__interface) != nullptr);
+
+        const LV2_Feature* features[] = { nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        BOOST_REQUIRE (handle != nullptr);
+
+        lvtk::UIArgs args;
+        args.bundle = "/fake/path";
+        args.plugin = LVTK_TEST_PLUGIN_URI;
+        {
+            // without instance access there is nothing to read from
+            std::unique_ptr<SnapshotUI> ui (new SnapshotUI (args));
+            BOOST_REQUIRE (! ui->snapshots_available());
+            BOOST_REQUIRE (ui->latest_snapshot<SnapshotMeters>() == nullptr);
+        }
+
+        LV2_Extension_Data_Feature data_data;
+        data_data.data_access = desc.extension_data;
+        args.features.push_back ({ LV2_DATA_ACCESS_URI, &data_data });
+        args.features.push_back ({ LV2_INSTANCE_ACCESS_URI, handle });
+        std::unique_ptr<SnapshotUI> ui (new SnapshotUI (args));
+        BOOST_REQUIRE (ui->snapshots_available());
+
+        bool updated = true;
+        auto meters  = ui->latest_snapshot<SnapshotMeters> (&updated);
+        BOOST_REQUIRE (meters != nullptr);
+        BOOST_REQUIRE (! updated);
+        BOOST_REQUIRE_EQUAL (meters->block, 0u);
+
+        desc.run (handle, 64);
+        desc.run (handle, 128);
+        meters = ui->latest_snapshot<SnapshotMeters> (&updated);
+        BOOST_REQUIRE (updated);
+        BOOST_REQUIRE_EQUAL (meters->block, 2u);
+        BOOST_REQUIRE_EQUAL (meters->peak[14], 128.f);
+
+        meters = ui->latest_snapshot<SnapshotMeters> (&updated);
+        BOOST_REQUIRE (! updated);
+        BOOST_REQUIRE_EQUAL (meters->block, 2u);
+
+        // wrong type, wrong size
+        BOOST_REQUIRE (ui->latest_snapshot<uint32_t>() == nullptr);
+
+        ui.reset();
+        desc.cleanup (handle);
+        lvtk::descriptors().pop_back();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Snapshot)
+
+BOOST_AUTO_TEST_CASE (triple_buffer) {
+    SnapshotTest().triple_buffer();
+}
+
+BOOST_AUTO_TEST_CASE (no_torn_reads) {
+    SnapshotTest().no_torn_reads();
+}
+
+BOOST_AUTO_TEST_CASE (plugin_to_ui) {
+    SnapshotTest().plugin_to_ui();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
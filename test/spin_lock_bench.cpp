@@ -0,0 +1,63 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "bench.hpp"
+
+#include <lvtk/spin_lock.hpp>
+#include <lvtk/spin_lock.ipp>
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// time lock + unlock on this thread while `others` threads hammer the lock
+template <class Lock>
+void contended (const std::string& label, Lock& lock, int others) {
+    std::atomic<bool> stop { false };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < others; ++i)
+        threads.emplace_back ([&] {
+            while (! stop.load (std::memory_order_relaxed)) {
+                lock.lock();
+                lock.unlock();
+            }
+        });
+
+    uint64_t value = 0;
+    bench::measure (label + " x" + std::to_string (others + 1), [&] {
+        lock.lock();
+        bench::keep (++value);
+        lock.unlock();
+    });
+
+    stop.store (true);
+    for (auto& t : threads)
+        t.join();
+}
+} // namespace
+
+BENCH_SUITE (SpinLock) {
+    const int cores = (int) std::thread::hardware_concurrency();
+    for (int others : { 0, 1, 3 }) {
+        if (others > 0 && others >= cores)
+            break;
+        std::mutex mutex;
+        lvtk::SpinLock spin;
+        lvtk::SharedSpinLock shared;
+        contended ("std::mutex", mutex, others);
+        contended ("SpinLock", spin, others);
+        contended ("SharedSpinLock", shared, others);
+        const auto s = spin.stats();
+        std::printf ("  %-40s %12llu / %llu\n", "SpinLock contended / yields",
+                     (unsigned long long) s.contended, (unsigned long long) s.yields);
+    }
+
+    lvtk::SpinLock held;
+    held.lock();
+    bench::measure ("SpinLock try_lock_for(64) timeout", [&] { bench::keep (held.try_lock_for (64)); });
+    held.unlock();
+}
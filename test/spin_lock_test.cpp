@@ -0,0 +1,159 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/spin_lock.hpp>
+#include <lvtk/spin_lock.ipp>
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+class SpinLockTest {
+public:
+    void basics() {
+        lvtk::SpinLock lock;
+        BOOST_REQUIRE (! lock.locked());
+        BOOST_REQUIRE (lock.try_lock());
+        BOOST_REQUIRE (lock.locked());
+        BOOST_REQUIRE (! lock.try_lock());
+        BOOST_REQUIRE (! lock.try_lock_for (100));
+        BOOST_REQUIRE_EQUAL (lock.stats().contended, 1u);
+        BOOST_REQUIRE_EQUAL (lock.stats().timeouts, 1u);
+        lock.unlock();
+        BOOST_REQUIRE (lock.try_lock_for (100));
+        lock.unlock();
+
+        lock.reset_stats();
+        BOOST_REQUIRE_EQUAL (lock.stats().timeouts, 0u);
+        {
+            std::lock_guard<lvtk::SpinLock> guard (lock);
+            BOOST_REQUIRE (lock.locked());
+        }
+        BOOST_REQUIRE (! lock.locked());
+        BOOST_REQUIRE_EQUAL (lock.stats().contended, 0u);
+    }
+
+    void contention() {
+        lvtk::SpinLock lock;
+        int counter = 0;
+        run_threads (4, [&] {
+            for (int i = 0; i < 20000; ++i) {
+                std::lock_guard<lvtk::SpinLock> guard (lock);
+                ++counter;
+            }
+        });
+        BOOST_REQUIRE_EQUAL (counter, 4 * 20000);
+        BOOST_REQUIRE (! lock.locked());
+    }
+
+    void shared() {
+        lvtk::SharedSpinLock lock;
+        BOOST_REQUIRE (lock.try_lock_shared());
+        BOOST_REQUIRE (lock.try_lock_shared());
+        BOOST_REQUIRE_EQUAL (lock.readers(), 2u);
+        BOOST_REQUIRE (! lock.try_lock());
+        BOOST_REQUIRE (! lock.try_lock_for (10));
+        lock.unlock_shared();
+        lock.unlock_shared();
+
+        BOOST_REQUIRE (lock.try_lock());
+        BOOST_REQUIRE (lock.locked());
+        BOOST_REQUIRE (! lock.try_lock_shared_for (10));
+        lock.unlock();
+        BOOST_REQUIRE (! lock.locked());
+        BOOST_REQUIRE_EQUAL (lock.readers(), 0u);
+        BOOST_REQUIRE_EQUAL (lock.stats().timeouts, 2u);
+
+        // readers always see both halves written together
+        lvtk::SharedSpinLock rw;
+        int a = 0, b = 0;
+        std::atomic<int> bad { 0 };
+        run_threads (4, [&] {
+            for (int i = 0; i < 20000; ++i) {
+                if (i % 8 == 0) {
+                    std::lock_guard<lvtk::SharedSpinLock> guard (rw);
+                    ++a;
+                    ++b;
+                } else {
+                    std::shared_lock<lvtk::SharedSpinLock> guard (rw);
+                    if (a != b)
+                        ++bad;
+                }
+            }
+        });
+        BOOST_REQUIRE_EQUAL (bad.load(), 0);
+        BOOST_REQUIRE_EQUAL (a, 4 * 2500);
+        BOOST_REQUIRE_EQUAL (rw.readers(), 0u);
+        BOOST_REQUIRE (! rw.locked());
+    }
+
+    void waiting_writers() {
+        lvtk::SharedSpinLock lock;
+        std::atomic<int> acquired { 0 };
+        std::atomic<bool> go { false };
+        BOOST_REQUIRE (lock.try_lock_shared());
+
+        std::vector<std::thread> writers;
+        for (int i = 0; i < 2; ++i) {
+            writers.emplace_back ([&] {
+                lock.lock();
+                ++acquired;
+                while (! go.load())
+                    std::this_thread::yield();
+                lock.unlock();
+            });
+        }
+        while (lock.writers_waiting() < 2)
+            std::this_thread::yield();
+        lock.unlock_shared();
+
+        // the first writer in keeps the other one counted, readers stay out
+        while (acquired.load() < 1)
+            std::this_thread::yield();
+        BOOST_REQUIRE (lock.locked());
+        BOOST_REQUIRE_EQUAL (lock.writers_waiting(), 1u);
+        BOOST_REQUIRE (! lock.try_lock_shared());
+
+        go = true;
+        for (auto& t : writers)
+            t.join();
+        BOOST_REQUIRE_EQUAL (acquired.load(), 2);
+        BOOST_REQUIRE_EQUAL (lock.writers_waiting(), 0u);
+        BOOST_REQUIRE (lock.try_lock_shared());
+        lock.unlock_shared();
+    }
+
+private:
+    template <class Fn>
+    static void run_threads (int count, Fn&& fn) {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < count; ++i)
+            threads.emplace_back (fn);
+        for (auto& t : threads)
+            t.join();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (SpinLock)
+
+BOOST_AUTO_TEST_CASE (basics) {
+    SpinLockTest().basics();
+}
+
+BOOST_AUTO_TEST_CASE (contention) {
+    SpinLockTest().contention();
+}
+
+BOOST_AUTO_TEST_CASE (shared) {
+    SpinLockTest().shared();
+}
+
+BOOST_AUTO_TEST_CASE (waiting_writers) {
+    SpinLockTest().waiting_writers();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,8 @@
 #include <boost/test/unit_test.hpp>
 #include <lvtk/string.hpp>
 
+#include <limits>
+
 #define LOREM_IPSUM \
     R"(Lorem ipsum dolor sit amet, consectetur adipiscing elit. In ut dolor sed lectus condimentum scelerisque ut at ex. Aenean feugiat velit sodales tempus condimentum. Nam sed neque velit. Nulla pretium ut nulla a placerat. Aliquam erat volutpat. Fusce volutpat, urna ut aliquet finibus, nunc mauris porta lacus, ut lacinia dolor sapien ut enim. Vestibulum quis diam mattis, laoreet augue ut, tincidunt magna. Duis semper sit amet leo gravida semper. Lorem ipsum dolor sit amet, consectetur adipiscing elit.)"
 
@@ -60,4 +62,65 @@ BOOST_AUTO_TEST_CASE (streams) {
     BOOST_REQUIRE_EQUAL (s1, LOREM_IPSUM);
 }
 
+BOOST_AUTO_TEST_CASE (fixed) {
+    using lvtk::String;
+    FixedString<32> s1 = "hello";
+    BOOST_REQUIRE_EQUAL (s1, "hello");
+    BOOST_REQUIRE_EQUAL (s1.size(), 5);
+    s1 << " " << String ("world");
+    BOOST_REQUIRE_EQUAL (s1, "hello world");
+    BOOST_REQUIRE (! s1.truncated());
+
+    s1.clear();
+    s1 << int (-1) << ' ' << int64_t (100) << ' ' << uint32_t (7);
+    BOOST_REQUIRE_EQUAL (s1.str(), "-1 100 7");
+
+    // unsigned 64 bit and other widths aren't ambiguous
+    s1.clear();
+    s1 << size_t (5) << ' ' << UINT64_MAX << ' ' << long (-2) << ' ' << (unsigned short) 3;
+    BOOST_REQUIRE_EQUAL (s1.str(), "5 18446744073709551615 -2 3");
+
+    s1.clear();
+    s1 << double (1.555000) << ' ' << float (1.444000);
+    BOOST_REQUIRE_EQUAL (s1.str(), "1.555000 1.444000");
+
+    String s2;
+    s2 << double (1.555000) << " " << float (1.444000);
+    BOOST_REQUIRE_EQUAL (s1.str(), s2.str());
+
+    FixedString<32> s3 = s1;
+    BOOST_REQUIRE (s3 == s1);
+    s3 << 'x';
+    BOOST_REQUIRE (s3 != s1);
+
+    const auto& same = s3;
+    s3               = same;
+    BOOST_REQUIRE_EQUAL (s3.str(), s1.str() + "x");
+
+    // the longest number still fits the format buffer
+    String s4;
+    s4 << std::numeric_limits<double>::lowest();
+    BOOST_REQUIRE_EQUAL (s4.str(), std::to_string (std::numeric_limits<double>::lowest()));
+}
+
+BOOST_AUTO_TEST_CASE (fixed_truncation) {
+    FixedString<8> s1;
+    s1 << "1234" << "5678";
+    BOOST_REQUIRE_EQUAL (s1, "12345678");
+    BOOST_REQUIRE (! s1.truncated());
+    s1 << 'x';
+    BOOST_REQUIRE_EQUAL (s1, "12345678");
+    BOOST_REQUIRE (s1.truncated());
+
+    s1.clear();
+    BOOST_REQUIRE (s1.empty() && ! s1.truncated());
+    s1 << "ab" << 1.5;
+    BOOST_REQUIRE_EQUAL (s1, "ab1.5000");
+    BOOST_REQUIRE (s1.truncated());
+
+    FixedString<16> s2 = LOREM_IPSUM;
+    BOOST_REQUIRE_EQUAL (s2.size(), s2.capacity());
+    BOOST_REQUIRE_EQUAL (s2.str(), std::string (LOREM_IPSUM).substr (0, 16));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
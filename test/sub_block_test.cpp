@@ -0,0 +1,115 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/sub_block.hpp>
+
+#include <cstring>
+#include <vector>
+
+struct SubBlockPlug : lvtk::Plugin<SubBlockPlug, lvtk::SubBlocks> {
+    SubBlockPlug (const lvtk::Args& args) : Plugin (args) {
+        sub_block_port (0, lvtk::SubBlockPort::AUDIO);
+        sub_block_port (1, lvtk::SubBlockPort::AUDIO);
+        sub_block_port (2, lvtk::SubBlockPort::ATOM_IN);
+        set_sub_block_size (64);
+    }
+
+    void connect_port (uint32_t port, void* data) {
+        if (port == 0)
+            input = (const float*) data;
+        else if (port == 1)
+            output = (float*) data;
+    }
+
+    void process (const lvtk::SubBlock& block) {
+        blocks.push_back (block);
+        for (const auto& ev : sub_block_events (2))
+            events.push_back ({ block.offset, (uint32_t) ev.time.frames });
+        for (uint32_t i = 0; i < block.nframes; ++i)
+            output[i] = input[i] * 2.f;
+    }
+
+    const float* input = nullptr;
+    float* output      = nullptr;
+    std::vector<lvtk::SubBlock> blocks;
+    std::vector<std::pair<uint32_t, uint32_t>> events;
+};
+
+class SubBlockTest {
+public:
+    void split() {
+        lvtk::Descriptor<SubBlockPlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        const LV2_Feature* features[] = { nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        auto plugin                   = static_cast<SubBlockPlug*> (handle);
+        BOOST_REQUIRE (plugin != nullptr);
+
+        std::vector<float> input (200), output (200, 0.f);
+        for (size_t i = 0; i < input.size(); ++i)
+            input[i] = (float) i;
+
+        // events at 0, 10, 10, 150 and one stamped past the block
+        alignas (8) uint8_t buffer[512];
+        auto seq       = reinterpret_cast<LV2_Atom_Sequence*> (buffer);
+        seq->atom.type = 0;
+        seq->atom.size = sizeof (LV2_Atom_Sequence_Body);
+        seq->body.unit = 0;
+        seq->body.pad  = 0;
+        for (int64_t frame : { 0, 10, 10, 150, 300 }) {
+            auto ev         = lv2_atom_sequence_end (&seq->body, seq->atom.size);
+            ev->time.frames = frame;
+            ev->body.size   = 0;
+            ev->body.type   = 0;
+            seq->atom.size += sizeof (LV2_Atom_Event);
+        }
+
+        desc.connect_port (handle, 0, input.data());
+        desc.connect_port (handle, 1, output.data());
+        desc.connect_port (handle, 2, seq);
+        desc.run (handle, 200);
+
+        const std::vector<std::pair<uint32_t, uint32_t>> expect_blocks = {
+            { 0, 10 }, { 10, 64 }, { 74, 64 }, { 138, 12 }, { 150, 50 }
+        };
+        BOOST_REQUIRE_EQUAL (plugin->blocks.size(), expect_blocks.size());
+        for (size_t i = 0; i < expect_blocks.size(); ++i) {
+            BOOST_REQUIRE_EQUAL (plugin->blocks[i].offset, expect_blocks[i].first);
+            BOOST_REQUIRE_EQUAL (plugin->blocks[i].nframes, expect_blocks[i].second);
+        }
+
+        const std::vector<std::pair<uint32_t, uint32_t>> expect_events = {
+            { 0, 0 }, { 10, 10 }, { 10, 10 }, { 150, 150 }, { 150, 300 }
+        };
+        BOOST_REQUIRE (plugin->events == expect_events);
+
+        for (size_t i = 0; i < output.size(); ++i)
+            BOOST_REQUIRE_EQUAL (output[i], 2.f * (float) i);
+
+        // host buffers restored, no events outside process()
+        BOOST_REQUIRE (plugin->input == input.data());
+        BOOST_REQUIRE (plugin->output == output.data());
+        BOOST_REQUIRE (plugin->sub_block_events (2).empty());
+
+        // no events, exact multiple
+        plugin->blocks.clear();
+        seq->atom.size = sizeof (LV2_Atom_Sequence_Body);
+        desc.run (handle, 128);
+        BOOST_REQUIRE_EQUAL (plugin->blocks.size(), 2u);
+        BOOST_REQUIRE_EQUAL (plugin->blocks[1].offset, 64u);
+        desc.cleanup (handle);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (SubBlock)
+
+BOOST_AUTO_TEST_CASE (split) {
+    SubBlockTest().split();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <lvtk/ext/batch_writes.hpp>
+#include <lvtk/ext/coalesce.hpp>
 #include <lvtk/ext/idle.hpp>
+#include <lvtk/ext/idle_scheduler.hpp>
 #include <lvtk/ext/parent.hpp>
 #include <lvtk/ext/port_map.hpp>
 #include <lvtk/ext/port_subscribe.hpp>
@@ -14,19 +17,34 @@
 #include <lvtk/ext/atom.hpp>
 #include <lvtk/ext/bufsize.hpp>
 #include <lvtk/ext/data_access.hpp>
+#include <lvtk/ext/denormals.hpp>
+#include <lvtk/ext/fixed_block.hpp>
 #include <lvtk/ext/instance_access.hpp>
+#include <lvtk/ext/instance_arena.hpp>
 #include <lvtk/ext/log.hpp>
 #include <lvtk/ext/options.hpp>
 #include <lvtk/ext/resize_port.hpp>
+#include <lvtk/ext/silence.hpp>
+#include <lvtk/ext/snapshot.hpp>
 #include <lvtk/ext/state.hpp>
+#include <lvtk/ext/sub_block.hpp>
 #include <lvtk/ext/urid.hpp>
+#include <lvtk/ext/visible_subscriptions.hpp>
 #include <lvtk/ext/worker.hpp>
 
+#include <lvtk/arena.hpp>
+#include <lvtk/flat_map.hpp>
 #include <lvtk/lvtk.hpp>
 #include <lvtk/optional.hpp>
 #include <lvtk/options.hpp>
+#include <lvtk/parameter_block.hpp>
 #include <lvtk/plugin.hpp>
+#include <lvtk/ring_deque.hpp>
+#include <lvtk/static_vector.hpp>
 #include <lvtk/symbols.hpp>
+#include <lvtk/tlsf.hpp>
+#include <lvtk/trace.hpp>
+#include <lvtk/triple_buffer.hpp>
 #include <lvtk/ui.hpp>
 
 #ifndef LVTK_VOLUME_URI
@@ -0,0 +1,192 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/tlsf.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <vector>
+
+class TlsfTest {
+public:
+    void allocate() {
+        lvtk::TlsfResource pool (64 * 1024);
+        const auto empty = pool.statistics();
+        BOOST_REQUIRE_GT (empty.capacity, 60u * 1024u);
+        BOOST_REQUIRE_EQUAL (empty.used, 0u);
+
+        auto a = pool.try_allocate (1);
+        auto b = pool.try_allocate (100);
+        auto c = pool.try_allocate (1000);
+        BOOST_REQUIRE (a != nullptr && b != nullptr && c != nullptr);
+        BOOST_REQUIRE (pool.owns (a) && pool.owns (b) && pool.owns (c));
+        for (auto p : { a, b, c })
+            BOOST_REQUIRE_EQUAL ((uintptr_t) p % alignof (std::max_align_t), 0u);
+
+        std::memset (a, 1, 1);
+        std::memset (b, 2, 100);
+        std::memset (c, 3, 1000);
+        BOOST_REQUIRE_EQUAL (((uint8_t*) b)[99], 2);
+
+        auto stats = pool.statistics();
+        BOOST_REQUIRE_EQUAL (stats.allocations, 3u);
+        BOOST_REQUIRE_GE (stats.used, 1101u);
+
+        pool.deallocate (b, 100);
+        pool.deallocate (a, 1);
+        pool.deallocate (c, 1000);
+        stats = pool.statistics();
+        BOOST_REQUIRE_EQUAL (stats.allocations, 0u);
+        BOOST_REQUIRE_EQUAL (stats.used, 0u);
+        BOOST_REQUIRE_GE (stats.high_water, 1101u);
+
+        // everything merged back into one block
+        auto all = pool.try_allocate (empty.capacity);
+        BOOST_REQUIRE (all != nullptr);
+        pool.deallocate (all, empty.capacity);
+    }
+
+    void alignment() {
+        lvtk::TlsfResource pool (64 * 1024);
+        std::vector<void*> blocks;
+        for (std::size_t align = 32; align <= 4096; align *= 2) {
+            blocks.push_back (pool.try_allocate (24, 8));
+            auto p = pool.try_allocate (align / 2 + 3, align);
+            BOOST_REQUIRE (p != nullptr);
+            BOOST_REQUIRE_EQUAL ((uintptr_t) p % align, 0u);
+            blocks.push_back (p);
+        }
+        for (auto p : blocks)
+            pool.deallocate (p, 0);
+        BOOST_REQUIRE (pool.try_allocate (pool.statistics().capacity) != nullptr);
+    }
+
+    void exhaustion() {
+        alignas (64) static uint8_t buffer[4096];
+        lvtk::TlsfResource pool (buffer, sizeof (buffer));
+        BOOST_REQUIRE (pool.owns (buffer + 64));
+
+        BOOST_REQUIRE (pool.try_allocate (sizeof (buffer)) == nullptr);
+        BOOST_REQUIRE (pool.try_allocate (SIZE_MAX) == nullptr);
+        BOOST_REQUIRE_THROW ((void) pool.allocate (8192), std::bad_alloc);
+        BOOST_REQUIRE_EQUAL (pool.statistics().failures, 3u);
+
+        std::vector<void*> blocks;
+        while (auto p = pool.try_allocate (64))
+            blocks.push_back (p);
+        BOOST_REQUIRE_GT (blocks.size(), 30u);
+
+        pool.deallocate (blocks.back(), 64);
+        blocks.pop_back();
+        BOOST_REQUIRE (pool.try_allocate (64) != nullptr);
+
+        lvtk::TlsfResource none (nullptr, 0);
+        BOOST_REQUIRE (none.try_allocate (1) == nullptr);
+    }
+
+    void arena() {
+        lvtk::ArenaOptions opts;
+        opts.size  = 16 * 1024;
+        auto arena = lvtk::Arena::create (opts);
+        BOOST_REQUIRE (arena != nullptr);
+        {
+            lvtk::TlsfResource pool (*arena, 8 * 1024);
+            auto p = pool.try_allocate (512);
+            BOOST_REQUIRE (p != nullptr && arena->owns (p));
+
+            lvtk::TlsfResource too_big (*arena, 1024 * 1024);
+            BOOST_REQUIRE_EQUAL (too_big.statistics().capacity, 0u);
+        }
+        lvtk::Arena::destroy (arena);
+    }
+
+    void pmr() {
+        lvtk::TlsfResource pool (64 * 1024);
+        {
+            std::pmr::vector<int> values (&pool);
+            for (int i = 0; i < 1000; ++i)
+                values.push_back (i);
+            BOOST_REQUIRE (pool.owns (values.data()));
+            BOOST_REQUIRE_EQUAL (values[999], 999);
+        }
+        BOOST_REQUIRE_EQUAL (pool.statistics().used, 0u);
+        BOOST_REQUIRE_GE (pool.statistics().high_water, 1000u * sizeof (int));
+
+        pool.reset_high_water();
+        BOOST_REQUIRE_EQUAL (pool.statistics().high_water, 0u);
+    }
+
+    void stress() {
+        lvtk::TlsfResource pool (256 * 1024);
+        const auto capacity = pool.statistics().capacity;
+
+        struct Live {
+            uint8_t* ptr;
+            std::size_t size;
+            uint8_t tag;
+        };
+        std::vector<Live> live;
+        std::mt19937 rng (1234);
+
+        for (int i = 0; i < 20000; ++i) {
+            if (live.empty() || rng() % 3 != 0) {
+                const std::size_t size  = 1 + rng() % 2000;
+                const std::size_t align = std::size_t (1) << (rng() % 8);
+                auto p                  = static_cast<uint8_t*> (pool.try_allocate (size, align));
+                if (p == nullptr)
+                    continue;
+                BOOST_REQUIRE_EQUAL ((uintptr_t) p % align, 0u);
+                const auto tag = (uint8_t) (i & 0xff);
+                std::memset (p, tag, size);
+                live.push_back ({ p, size, tag });
+            } else {
+                const auto index = rng() % live.size();
+                const auto item  = live[index];
+                for (std::size_t b = 0; b < item.size; ++b)
+                    if (item.ptr[b] != item.tag)
+                        BOOST_FAIL ("block overwritten");
+                pool.deallocate (item.ptr, item.size);
+                live[index] = live.back();
+                live.pop_back();
+            }
+        }
+
+        for (const auto& item : live)
+            pool.deallocate (item.ptr, item.size);
+        BOOST_REQUIRE_EQUAL (pool.statistics().used, 0u);
+        BOOST_REQUIRE (pool.try_allocate (capacity) != nullptr);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Tlsf)
+
+BOOST_AUTO_TEST_CASE (allocate) {
+    TlsfTest().allocate();
+}
+
+BOOST_AUTO_TEST_CASE (alignment) {
+    TlsfTest().alignment();
+}
+
+BOOST_AUTO_TEST_CASE (exhaustion) {
+    TlsfTest().exhaustion();
+}
+
+BOOST_AUTO_TEST_CASE (arena) {
+    TlsfTest().arena();
+}
+
+BOOST_AUTO_TEST_CASE (pmr) {
+    TlsfTest().pmr();
+}
+
+BOOST_AUTO_TEST_CASE (stress) {
+    TlsfTest().stress();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,140 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+// hooks are on in this test only, the plugin type below is unique to it
+#define LVTK_TRACE 1
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/worker.hpp>
+#include <lvtk/plugin.hpp>
+#include <lvtk/trace.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct TracePlug : lvtk::Plugin<TracePlug, lvtk::Worker> {
+    TracePlug (const lvtk::Args& args) : Plugin (args) {}
+    void run (uint32_t) {}
+};
+
+class TraceTest {
+public:
+    TraceTest() { recorder.clear(); }
+    ~TraceTest() { recorder.clear(); }
+
+    void hooks() {
+        lvtk::Descriptor<TracePlug> reg (LVTK_TEST_PLUGIN_URI);
+        const auto& desc = lvtk::descriptors().back();
+
+        const LV2_Feature* features[] = { nullptr };
+        auto handle                   = desc.instantiate (&desc, 44100.0, "/fake/path", features);
+        BOOST_REQUIRE (handle != nullptr);
+        float buffer[128];
+        desc.connect_port (handle, 3, buffer);
+        desc.activate (handle);
+        desc.run (handle, 128);
+        auto iface = (const LV2_Worker_Interface*) desc.extension_data (LV2_WORKER__interface);
+        uint32_t job = 0;
+        iface->work (handle, nullptr, nullptr, sizeof (job), &job);
+        iface->end_run (handle);
+        desc.deactivate (handle);
+        desc.cleanup (handle);
+        lvtk::descriptors().pop_back();
+
+        const auto events = recorder.events();
+        std::vector<std::string> names;
+        for (const auto& ev : events)
+            names.push_back (ev.name);
+        const std::vector<std::string> expected = {
+            "instantiate", "connect_port", "activate", "run", "work", "end_run", "deactivate", "cleanup"
+        };
+        BOOST_REQUIRE_EQUAL_COLLECTIONS (names.begin(), names.end(), expected.begin(), expected.end());
+
+        BOOST_REQUIRE_EQUAL (events[1].value, 3u);
+        BOOST_REQUIRE_EQUAL (events[3].value, 128u);
+        BOOST_REQUIRE_EQUAL (events[4].value, sizeof (job));
+        for (std::size_t i = 1; i < events.size(); ++i)
+            BOOST_REQUIRE_GE (events[i].start, events[i - 1].start + events[i - 1].duration);
+        BOOST_REQUIRE_EQUAL (events[0].thread, lvtk::trace::thread_id());
+    }
+
+    void ring() {
+        const uint32_t total = lvtk::trace::Recorder::capacity + 100;
+        for (uint32_t i = 0; i < total; ++i)
+            recorder.record ("event", i, 1, i);
+        const auto events = recorder.events();
+        BOOST_REQUIRE_EQUAL (events.size(), (std::size_t) lvtk::trace::Recorder::capacity);
+        BOOST_REQUIRE_EQUAL (events.front().value, 100u);
+        BOOST_REQUIRE_EQUAL (events.back().value, total - 1);
+
+        recorder.clear();
+        BOOST_REQUIRE (recorder.events().empty());
+
+        recorder.set_enabled (false);
+        recorder.record ("off", 0, 0, 0);
+        recorder.set_enabled (true);
+        BOOST_REQUIRE (recorder.events().empty());
+    }
+
+    void threads() {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+            threads.emplace_back ([] {
+                for (int i = 0; i < 500; ++i) {
+                    const lvtk::trace::Scope scope ("thread", (uint64_t) i);
+                }
+            });
+        for (auto& t : threads)
+            t.join();
+
+        const auto events = recorder.events();
+        BOOST_REQUIRE_EQUAL (events.size(), 2000u);
+        std::vector<uint32_t> ids;
+        for (const auto& ev : events) {
+            BOOST_REQUIRE_EQUAL (std::strcmp (ev.name, "thread"), 0);
+            if (std::find (ids.begin(), ids.end(), ev.thread) == ids.end())
+                ids.push_back (ev.thread);
+        }
+        BOOST_REQUIRE_EQUAL (ids.size(), 4u);
+    }
+
+    void chrome_json() {
+        recorder.record ("run", 1000, 2500, 64);
+        recorder.record ("work", 5000, 10, 4);
+        const auto json = recorder.chrome_json();
+        BOOST_REQUIRE_EQUAL (json.rfind ("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+        BOOST_REQUIRE (json.find ("\"name\":\"run\",\"cat\":\"lvtk\",\"ph\":\"X\"") != std::string::npos);
+        BOOST_REQUIRE (json.find ("\"ts\":0.000,\"dur\":2.500,\"args\":{\"value\":64}}") != std::string::npos);
+        BOOST_REQUIRE (json.find ("\"ts\":4.000,\"dur\":0.010,\"args\":{\"value\":4}}") != std::string::npos);
+        BOOST_REQUIRE (json.find ("]}") != std::string::npos);
+    }
+
+private:
+    lvtk::trace::Recorder& recorder = lvtk::trace::Recorder::instance();
+};
+
+BOOST_AUTO_TEST_SUITE (Trace)
+
+BOOST_AUTO_TEST_CASE (hooks) {
+    TraceTest().hooks();
+}
+
+BOOST_AUTO_TEST_CASE (ring) {
+    TraceTest().ring();
+}
+
+BOOST_AUTO_TEST_CASE (threads) {
+    TraceTest().threads();
+}
+
+BOOST_AUTO_TEST_CASE (chrome_json) {
+    TraceTest().chrome_json();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,186 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/atom.hpp>
+#include <lvtk/symbols.hpp>
+#include <lvtk/transport.hpp>
+
+#include <lv2/time/time.h>
+
+#include <vector>
+
+class TransportTest {
+public:
+    TransportTest() {
+        forge.init ((LV2_URID_Map*) symbols.map_feature()->data);
+    }
+
+    void position() {
+        lvtk::Transport transport ((LV2_URID_Map*) symbols.map_feature()->data, 48000.0);
+        BOOST_REQUIRE (! transport.state().rolling());
+
+        begin();
+        lvtk::ForgeFrame obj;
+        position (obj, 0);
+        forge.write_key (symbols.map (LV2_TIME__speed));
+        forge.write_float (1.f);
+        forge.write_key (symbols.map (LV2_TIME__beatsPerMinute));
+        forge.write_float (120.f);
+        forge.write_key (symbols.map (LV2_TIME__beat));
+        forge.write_double (5.5);
+        forge.write_key (symbols.map (LV2_TIME__frame));
+        forge.write_long (1000);
+        forge.pop (obj);
+        BOOST_REQUIRE_EQUAL (transport.process (end(), 48000), 1u);
+
+        BOOST_REQUIRE (transport.changed());
+        const auto& s = transport.state();
+        BOOST_REQUIRE (s.rolling());
+        BOOST_REQUIRE_EQUAL (s.bpm, 120.0);
+        // bar and barBeat filled in from beat
+        BOOST_REQUIRE_EQUAL (s.bar, 1);
+        BOOST_REQUIRE_EQUAL (s.bar_beat, 1.5);
+        BOOST_REQUIRE_CLOSE (transport.beat_at (24000), 6.5, 1.0e-9);
+
+        // two beats a second
+        std::vector<std::pair<uint32_t, double>> ticks;
+        transport.for_each_beat (1.0, 48000, [&] (uint32_t frame, double beat) { ticks.push_back ({ frame, beat }); });
+        const std::vector<std::pair<uint32_t, double>> expected = { { 12000, 6.0 }, { 36000, 7.0 } };
+        BOOST_REQUIRE (ticks == expected);
+
+        // no events, keeps rolling from the end of the last block
+        BOOST_REQUIRE_EQUAL (transport.process (nullptr, 48000), 0u);
+        BOOST_REQUIRE (! transport.changed());
+        BOOST_REQUIRE_CLOSE (transport.state().beat, 7.5, 1.0e-9);
+        BOOST_REQUIRE_EQUAL (transport.state().bar, 1);
+        BOOST_REQUIRE_CLOSE (transport.state().bar_beat, 3.5, 1.0e-9);
+        BOOST_REQUIRE_EQUAL (transport.state().frame, 49000);
+        BOOST_REQUIRE_EQUAL (transport.state_at (24000).bar, 2);
+    }
+
+    void tempo_change() {
+        lvtk::Transport transport ((LV2_URID_Map*) symbols.map_feature()->data, 100.0);
+
+        begin();
+        lvtk::ForgeFrame obj;
+        position (obj, 0);
+        forge.write_key (symbols.map (LV2_TIME__speed));
+        forge.write_float (1.f);
+        forge.write_key (symbols.map (LV2_TIME__beatsPerMinute));
+        forge.write_float (60.f);
+        forge.write_key (symbols.map (LV2_TIME__bar));
+        forge.write_long (2);
+        forge.write_key (symbols.map (LV2_TIME__barBeat));
+        forge.write_float (0.f);
+        forge.pop (obj);
+        // double time half way through
+        position (obj, 50);
+        forge.write_key (symbols.map (LV2_TIME__beatsPerMinute));
+        forge.write_float (120.f);
+        forge.pop (obj);
+        BOOST_REQUIRE_EQUAL (transport.process (end(), 100), 2u);
+
+        BOOST_REQUIRE_EQUAL (transport.state().beat, 8.0);
+        BOOST_REQUIRE_CLOSE (transport.beat_at (50), 8.5, 1.0e-9);
+        BOOST_REQUIRE_CLOSE (transport.beat_at (75), 9.0, 1.0e-9);
+        BOOST_REQUIRE_EQUAL (transport.state_at (75).bpm, 120.0);
+
+        std::vector<double> beats (100, 0.0);
+        transport.beats (beats.data(), 100);
+        BOOST_REQUIRE_CLOSE (beats[25], 8.25, 1.0e-9);
+        BOOST_REQUIRE_CLOSE (beats[99], 9.48, 1.0e-9);
+
+        uint32_t segments = 0;
+        transport.for_each_segment (100, [&] (uint32_t offset, uint32_t n, double, double step) {
+            BOOST_REQUIRE_EQUAL (n, 50u);
+            BOOST_REQUIRE_CLOSE (step, offset == 0 ? 0.01 : 0.02, 1.0e-9);
+            ++segments;
+        });
+        BOOST_REQUIRE_EQUAL (segments, 2u);
+
+        // stopping: nothing ticks, the position holds
+        begin();
+        position (obj, 0);
+        forge.write_key (symbols.map (LV2_TIME__speed));
+        forge.write_float (0.f);
+        forge.pop (obj);
+        transport.process (end(), 100);
+        BOOST_REQUIRE_CLOSE (transport.state().beat, 9.5, 1.0e-9);
+        BOOST_REQUIRE_CLOSE (transport.beat_at (99), 9.5, 1.0e-9);
+        uint32_t ticks = 0;
+        transport.for_each_beat (0.25, 100, [&] (uint32_t, double) { ++ticks; });
+        BOOST_REQUIRE_EQUAL (ticks, 0u);
+    }
+
+    void overflow() {
+        lvtk::BasicTransport<2> transport ((LV2_URID_Map*) symbols.map_feature()->data, 100.0);
+
+        // three updates, only room for the start and one more
+        begin();
+        lvtk::ForgeFrame obj;
+        position (obj, 0);
+        forge.write_key (symbols.map (LV2_TIME__speed));
+        forge.write_float (1.f);
+        forge.write_key (symbols.map (LV2_TIME__beatsPerMinute));
+        forge.write_float (60.f);
+        forge.write_key (symbols.map (LV2_TIME__beat));
+        forge.write_double (0.0);
+        forge.pop (obj);
+        position (obj, 50);
+        forge.write_key (symbols.map (LV2_TIME__beat));
+        forge.write_double (2.0);
+        forge.pop (obj);
+        position (obj, 100);
+        forge.write_key (symbols.map (LV2_TIME__beat));
+        forge.write_double (3.0);
+        forge.pop (obj);
+        BOOST_REQUIRE_EQUAL (transport.process (end(), 200), 3u);
+
+        BOOST_REQUIRE_EQUAL (transport.beat_at (0), 0.0);
+        BOOST_REQUIRE_CLOSE (transport.beat_at (99), 0.99, 1.0e-9);
+        BOOST_REQUIRE_EQUAL (transport.beat_at (100), 3.0);
+        BOOST_REQUIRE_CLOSE (transport.beat_at (150), 3.5, 1.0e-9);
+        BOOST_REQUIRE_EQUAL (transport.state_at (100).beat, 3.0);
+    }
+
+private:
+    lvtk::Symbols symbols;
+    lvtk::Forge forge;
+    lvtk::ForgeFrame frame;
+    alignas (8) uint8_t buffer[1024];
+
+    void begin() {
+        forge.set_buffer (buffer, sizeof (buffer));
+        forge.write_sequence_head (frame, 0);
+    }
+
+    const LV2_Atom_Sequence* end() {
+        forge.pop (frame);
+        return (const LV2_Atom_Sequence*) buffer;
+    }
+
+    void position (lvtk::ForgeFrame& obj, int64_t time) {
+        forge.write_frame_time (time);
+        forge.write_object (obj, 0, symbols.map (LV2_TIME__Position));
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (Transport)
+
+BOOST_AUTO_TEST_CASE (position) {
+    TransportTest().position();
+}
+
+BOOST_AUTO_TEST_CASE (tempo_change) {
+    TransportTest().tempo_change();
+}
+
+BOOST_AUTO_TEST_CASE (overflow) {
+    TransportTest().overflow();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,176 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "tests.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <lvtk/ext/show.hpp>
+#include <lvtk/ext/visible_subscriptions.hpp>
+#include <lvtk/symbols.hpp>
+#include <lvtk/ui.hpp>
+
+#include <lv2/atom/atom.h>
+#include <lv2/patch/patch.h>
+#include <lv2/ui/ui.h>
+
+#include <string>
+#include <vector>
+
+struct VisibleSubscriptionsUI : lvtk::UI<VisibleSubscriptionsUI, lvtk::Show, lvtk::VisibleSubscriptions> {
+    VisibleSubscriptionsUI (const lvtk::UIArgs& args) : UI (args) {
+        watch_port (4);
+        watch_port (5);
+        watch_port (4); // ignored
+        set_state_request_port (0);
+    }
+
+    int show() {
+        shown = visible();
+        return 0;
+    }
+
+    bool shown = false;
+};
+
+struct ManualVisibilityUI : lvtk::UI<ManualVisibilityUI, lvtk::VisibleSubscriptions> {
+    ManualVisibilityUI (const lvtk::UIArgs& args) : UI (args) {
+        watch_port (4);
+    }
+};
+
+class VisibleSubscriptionsTest {
+public:
+    VisibleSubscriptionsTest() {
+        subscribe_feature = { this, _subscribe, _unsubscribe };
+        features[0]       = symbols.map_feature();
+        features[1]       = &subscribe_data;
+        features[2]       = nullptr;
+    }
+
+    void show_hide() {
+        lvtk::UIDescriptor<VisibleSubscriptionsUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        LV2UI_Widget widget = nullptr;
+        auto handle         = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", _write, this, &widget, features);
+        BOOST_REQUIRE (handle != nullptr);
+        auto ui          = static_cast<VisibleSubscriptionsUI*> (handle);
+        const auto iface = (const LV2UI_Show_Interface*) desc.extension_data (LV2_UI__showInterface);
+        BOOST_REQUIRE (iface != nullptr);
+        // hidden until the host shows it
+        BOOST_REQUIRE (! ui->visible());
+        BOOST_REQUIRE_EQUAL (calls.size(), 2u);
+        BOOST_REQUIRE_EQUAL (calls[0], "-4");
+        BOOST_REQUIRE_EQUAL (calls[1], "-5");
+        BOOST_REQUIRE_EQUAL (write_count, 0);
+
+        calls.clear();
+        iface->show (handle);
+        BOOST_REQUIRE (ui->shown);
+        BOOST_REQUIRE_EQUAL (calls.size(), 2u);
+        BOOST_REQUIRE_EQUAL (calls[0], "+4");
+        BOOST_REQUIRE_EQUAL (calls[1], "+5");
+        BOOST_REQUIRE_EQUAL (write_count, 1);
+        iface->show (handle);
+        BOOST_REQUIRE_EQUAL (calls.size(), 2u);
+
+        calls.clear();
+        iface->hide (handle);
+        BOOST_REQUIRE (! ui->visible());
+        BOOST_REQUIRE_EQUAL (calls.size(), 2u);
+        BOOST_REQUIRE_EQUAL (calls[0], "-4");
+        BOOST_REQUIRE_EQUAL (calls[1], "-5");
+        iface->hide (handle);
+        BOOST_REQUIRE_EQUAL (calls.size(), 2u);
+
+        calls.clear();
+        iface->show (handle);
+        BOOST_REQUIRE (ui->shown);
+        BOOST_REQUIRE_EQUAL (calls.size(), 2u);
+        BOOST_REQUIRE_EQUAL (calls[0], "+4");
+        BOOST_REQUIRE_EQUAL (calls[1], "+5");
+
+        // the plugin is asked for its state each time
+        BOOST_REQUIRE_EQUAL (write_count, 2);
+        BOOST_REQUIRE_EQUAL (writes.size(), sizeof (LV2_Atom_Object));
+        BOOST_REQUIRE_EQUAL (write_protocol, symbols.map (LV2_ATOM__eventTransfer));
+        const auto get = reinterpret_cast<const LV2_Atom_Object*> (writes.data());
+        BOOST_REQUIRE_EQUAL (get->atom.type, symbols.map (LV2_ATOM__Object));
+        BOOST_REQUIRE_EQUAL (get->body.otype, symbols.map (LV2_PATCH__Get));
+
+        // ports watched while hidden aren't subscribed until shown
+        calls.clear();
+        ui->set_visible (false);
+        ui->watch_port (9, 7);
+        BOOST_REQUIRE_EQUAL (calls.back(), "-9");
+        calls.clear();
+        ui->set_visible (true);
+        BOOST_REQUIRE_EQUAL (calls.size(), 3u);
+        BOOST_REQUIRE_EQUAL (calls[2], "+9");
+
+        desc.cleanup (handle);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+    void without_show() {
+        lvtk::UIDescriptor<ManualVisibilityUI> reg (LVTK_TEST_UI_URI);
+        const auto& desc = lvtk::ui_descriptors().back();
+
+        LV2UI_Widget widget = nullptr;
+        auto handle         = desc.instantiate (&desc, LVTK_TEST_PLUGIN_URI, "/fake/path", _write, this, &widget, features);
+        BOOST_REQUIRE (handle != nullptr);
+        auto ui = static_cast<ManualVisibilityUI*> (handle);
+        BOOST_REQUIRE (desc.extension_data (LV2_UI__showInterface) == nullptr);
+
+        // visible from the start, the host's subscriptions are left alone
+        BOOST_REQUIRE (ui->visible());
+        BOOST_REQUIRE (calls.empty());
+        ui->set_visible (false);
+        BOOST_REQUIRE_EQUAL (calls.size(), 1u);
+        BOOST_REQUIRE_EQUAL (calls[0], "-4");
+
+        desc.cleanup (handle);
+        lvtk::ui_descriptors().pop_back();
+    }
+
+private:
+    lvtk::Symbols symbols;
+    LV2UI_Port_Subscribe subscribe_feature;
+    LV2_Feature subscribe_data { LV2_UI__portSubscribe, &subscribe_feature };
+    const LV2_Feature* features[3];
+    std::vector<std::string> calls;
+    std::vector<uint8_t> writes;
+    uint32_t write_protocol = 0;
+    int write_count         = 0;
+
+    static uint32_t _subscribe (LV2UI_Feature_Handle handle, uint32_t port, uint32_t, const LV2_Feature* const*) {
+        static_cast<VisibleSubscriptionsTest*> (handle)->calls.push_back ("+" + std::to_string (port));
+        return 0;
+    }
+
+    static uint32_t _unsubscribe (LV2UI_Feature_Handle handle, uint32_t port, uint32_t, const LV2_Feature* const*) {
+        static_cast<VisibleSubscriptionsTest*> (handle)->calls.push_back ("-" + std::to_string (port));
+        return 0;
+    }
+
+    static void _write (LV2UI_Controller controller, uint32_t, uint32_t size, uint32_t protocol, const void* data) {
+        auto self  = static_cast<VisibleSubscriptionsTest*> (controller);
+        auto bytes = static_cast<const uint8_t*> (data);
+        self->writes.assign (bytes, bytes + size);
+        self->write_protocol = protocol;
+        ++self->write_count;
+    }
+};
+
+BOOST_AUTO_TEST_SUITE (VisibleSubscriptions)
+
+BOOST_AUTO_TEST_CASE (show_hide) {
+    VisibleSubscriptionsTest().show_hide();
+}
+
+BOOST_AUTO_TEST_CASE (without_show) {
+    VisibleSubscriptionsTest().without_show();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,64 @@
+// Copyright 2026 Michael Fisher <mfisher@lvtk.org>
+// SPDX-License-Identifier: ISC
+
+#include "bench.hpp"
+
+#include <lvtk/weak_ref.hpp>
+
+#include <memory>
+
+namespace {
+class Plain {
+public:
+    Plain() { _weak_status.reset (this); }
+    ~Plain() { _weak_status.reset(); }
+    int value = 1;
+
+private:
+    LVTK_WEAK_REFABLE (Plain)
+};
+
+class Atomic {
+public:
+    Atomic() { _weak_status.reset (this); }
+    ~Atomic() { _weak_status.reset(); }
+    int value = 1;
+
+private:
+    LVTK_ATOMIC_WEAK_REFABLE (Atomic)
+};
+} // namespace
+
+BENCH_SUITE (WeakRef) {
+    bench::measure ("WeakStatus construct + destroy", [] {
+        Plain obj;
+        bench::keep (obj.value);
+    });
+    bench::measure ("AtomicWeakStatus construct + destroy", [] {
+        Atomic obj;
+        bench::keep (obj.value);
+    });
+
+    Plain plain;
+    Atomic atomic;
+    const lvtk::WeakRef<Plain> plain_ref (&plain);
+    const lvtk::AtomicWeakRef<Atomic> atomic_ref (&atomic);
+
+    bench::measure ("WeakRef copy", [&] {
+        lvtk::WeakRef<Plain> copy = plain_ref;
+        bench::keep (copy.get());
+    });
+    bench::measure ("AtomicWeakRef copy", [&] {
+        lvtk::AtomicWeakRef<Atomic> copy = atomic_ref;
+        bench::keep (copy);
+    });
+
+    bench::measure ("WeakRef lock", [&] {
+        if (auto p = plain_ref.lock())
+            bench::keep (p->value);
+    });
+    bench::measure ("AtomicWeakRef lock", [&] {
+        if (auto p = atomic_ref.lock())
+            bench::keep (p->value);
+    });
+}
@@ -4,7 +4,10 @@
 #include "lvtk/weak_ref.hpp"
 #include "tests.hpp"
 #include <boost/test/unit_test.hpp>
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 struct WeakRefTest {
     void basics() {
@@ -31,6 +34,79 @@ struct WeakRefTest {
         BOOST_REQUIRE (ref1.as<SubObject>() == nullptr);
     }
 
+    void atomic_basics() {
+        auto obj = std::make_unique<AtomicObject>();
+        AtomicRef ref (obj.get());
+        AtomicRef copy = ref;
+        BOOST_REQUIRE (ref.valid());
+        BOOST_REQUIRE (ref == copy);
+        {
+            auto locked = copy.lock();
+            BOOST_REQUIRE (locked);
+            BOOST_REQUIRE_EQUAL (locked.get(), obj.get());
+            BOOST_REQUIRE_EQUAL (locked->value, 42);
+        }
+        obj.reset();
+        BOOST_REQUIRE (! ref.valid());
+        BOOST_REQUIRE (! ref.lock());
+        BOOST_REQUIRE (! AtomicRef().lock());
+
+        // blocks go back to the pool and are reused
+        auto a     = std::make_unique<AtomicObject>();
+        auto block = a->status().block();
+        a.reset();
+        auto b = std::make_unique<AtomicObject>();
+        BOOST_REQUIRE (b->status().block() == block);
+    }
+
+    void atomic_threads() {
+        for (int round = 0; round < 20; ++round) {
+            auto obj = std::make_unique<AtomicObject>();
+            AtomicRef ref (obj.get());
+            std::atomic<bool> go { false };
+            std::atomic<int> bad { 0 }, seen { 0 };
+
+            std::vector<std::thread> readers;
+            for (int t = 0; t < 3; ++t)
+                readers.emplace_back ([&, ref] {
+                    while (! go.load())
+                        std::this_thread::yield();
+                    for (int i = 0; i < 20000; ++i) {
+                        if (auto locked = ref.lock()) {
+                            if (locked->value != 42)
+                                ++bad;
+                            ++seen;
+                        }
+                    }
+                });
+
+            go.store (true);
+            std::this_thread::yield();
+            obj.reset(); // destroyed while readers lock it
+            for (auto& t : readers)
+                t.join();
+            BOOST_REQUIRE_EQUAL (bad.load(), 0);
+            BOOST_REQUIRE (! ref.valid());
+        }
+    }
+
+    class AtomicObject {
+    public:
+        AtomicObject() { _weak_status.reset (this); }
+        ~AtomicObject() {
+            _weak_status.reset();
+            value = 0; // readers must never see this
+        }
+
+        const lvtk::AtomicWeakStatus<AtomicObject>& status() const { return _weak_status; }
+        volatile int value = 42;
+
+    private:
+        LVTK_ATOMIC_WEAK_REFABLE (AtomicObject)
+    };
+
+    using AtomicRef = lvtk::AtomicWeakRef<AtomicObject>;
+
     class TestObject {
     public:
         TestObject() { weak_status.reset (this); }
@@ -55,4 +131,12 @@ BOOST_AUTO_TEST_CASE (subclass) {
     WeakRefTest().subclass();
 }
 
+BOOST_AUTO_TEST_CASE (atomic_basics) {
+    WeakRefTest().atomic_basics();
+}
+
+BOOST_AUTO_TEST_CASE (atomic_threads) {
+    WeakRefTest().atomic_threads();
+}
+
 BOOST_AUTO_TEST_SUITE_END()